@@ -0,0 +1,86 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Measures the throughput of keyword highlighting for growing keyword sets:
+// the Aho–Corasick `Keyword_Highlighter` versus the per-position `Keyword_Rules` of AnsiColorsColorize.hpp.
+//
+// Build: g++ -std=c++17 -O2 -pthread -I include bench/HighlighterBench.cpp -o highlighter_bench
+//        or with CMake: -DANSICOLORS_BUILD_BENCHMARKS=ON, target `highlighter_bench`
+
+#include "AnsiColorsColorize.hpp"
+#include "AnsiColorsHighlight.hpp"
+#include "AnsiColorsPalette.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace ansi_colors;
+
+namespace {
+    /// A keyword like "svc-auth17" or "E4021"; the first few are the log levels.
+    std::string keyword(std::size_t index){
+        static const char* const levels[] = {"FATAL", "ERROR", "WARN", "INFO", "DEBUG", "TRACE"};
+        if(index < 6) return levels[index];
+        return index % 2 ? "svc-node" + std::to_string(index) : "E" + std::to_string(1000 + index);
+    }
+
+    /// About `size` bytes of log lines, in which roughly one word in eight is a keyword out of the first `keywords`.
+    std::string makeLog(std::size_t size, std::size_t keywords){
+        static const char* const words[] = {"request", "handled", "in", "ms", "user", "session", "opened", "closed",
+                                            "cache", "miss", "retry", "timeout", "payload", "bytes", "ok", "id"};
+        std::mt19937 random(42);
+        std::string log;
+        log.reserve(size + 128);
+        while(log.size() < size){
+            log += "2025-06-01T12:00:00Z ";
+            for(int word = 0; word < 12; ++word){
+                if(random() % 8 == 0) log += keyword(random() % keywords);
+                else log += words[random() % 16];
+                log += ' ';
+            }
+            log.back() = '\n';
+        }
+        return log;
+    }
+
+    template<typename Rules>
+    double megabytesPerSecond(const Rules& rules, const std::string& log, std::size_t& output_size){
+        std::string out;
+        out.reserve(log.size() * 2);
+        double best = 0.0;
+        for(int run = 0; run < 3; ++run){
+            out.clear();
+            const auto start = std::chrono::steady_clock::now();
+            rules.colorize(log, out);
+            const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+            const double speed = static_cast<double>(log.size()) / (1024.0 * 1024.0) / seconds.count();
+            if(speed > best) best = speed;
+        }
+        output_size = out.size();
+        return best;
+    }
+
+    void run(std::size_t keywords, const std::string& log){
+        Keyword_Highlighter highlighter;
+        Keyword_Rules rules;
+        for(std::size_t index = 0; index < keywords; ++index){
+            const Color& color = fg::PrimaryColors.Red.Pure_Red;
+            highlighter.add(keyword(index), color);
+            rules.add(keyword(index), color);
+        }
+        highlighter.prepare();
+
+        std::size_t highlighter_output = 0, rules_output = 0;
+        const double automaton = megabytesPerSecond(static_cast<const Keyword_Highlighter&>(highlighter), log, highlighter_output);
+        const double naive = megabytesPerSecond(rules, log, rules_output);
+        std::printf("keywords=%5zu  aho_corasick=%8.1f MiB/s  keyword_rules=%8.1f MiB/s  speedup=%6.1fx%s\n",
+                    keywords, automaton, naive, automaton / naive, highlighter_output == rules_output ? "" : "  (outputs differ)");
+    }
+}
+
+int main(){
+    for(std::size_t keywords : {6, 16, 64, 256, 1024, 4096}){
+        run(keywords, makeLog(std::size_t(32) << 20, keywords));
+    }
+    return 0;
+}
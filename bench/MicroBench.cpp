@@ -0,0 +1,435 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Micro-benchmarks of the hot paths of AnsiColors.hpp, with machine readable output to track regressions between versions.
+//
+// Usage: micro_bench [--format=text|json|csv] [--filter=<substring>] [--min-time=<ms>] [--label=<text>] [--check-allocs]
+// Build: g++ -std=c++17 -O2 -I include bench/MicroBench.cpp -o micro_bench
+//        (build with -std=c++20 as well to include the std::formatter specializations)
+//        or with CMake: -DANSICOLORS_BUILD_BENCHMARKS=ON, target `micro_bench`
+//
+// Every benchmark reports the median time per operation over several samples, the bytes produced per operation
+// where that applies, and the heap allocations per operation (global operator new is replaced by a counting version).
+// `--label` is copied in to the output, e.g. to record the version or commit that was measured.
+// `--check-allocs` makes the run fail (exit code 1) if any of the measured paths allocates; they should all be allocation free.
+
+#include "AnsiColors.hpp"
+#include "AnsiColorsContrast.hpp"
+#include "AnsiColorsNearest.hpp"
+#include "AnsiColorsParse.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#if LEMONCODE_ANSICOLORS_CPP20_OR_NEWER && defined(__cpp_lib_format)
+    #include <format>
+    #include <iterator>
+    #define ANSICOLORS_BENCH_FORMAT 1
+#else
+    #define ANSICOLORS_BENCH_FORMAT 0
+#endif
+
+using namespace ansi_colors;
+
+// --- Allocation counting ---
+
+namespace {
+    std::atomic<std::uint64_t> allocation_count {0};
+}
+
+void* operator new(std::size_t size){
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if(void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size){ return ::operator new(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace {
+    /// Keeps the compiler from optimizing `value` (and the work that produced it) away.
+    template<typename T>
+    inline void keep(const T& value){
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const volatile void* sink;
+        sink = &value;
+#endif
+    }
+
+    /// A stream buffer that discards everything, so `operator<<` is measured without the cost of a real sink.
+    class Null_Buffer final : public std::streambuf {
+    protected:
+        int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+
+    /// A stream buffer that appends to a `std::string`, like a log line being built.
+    class String_Buffer final : public std::streambuf {
+        std::string& out;
+    public:
+        explicit String_Buffer(std::string& out) : out(out){}
+    protected:
+        int_type overflow(int_type c) override {
+            if(!traits_type::eq_int_type(c, traits_type::eof())) out.push_back(traits_type::to_char_type(c));
+            return traits_type::not_eof(c);
+        }
+        std::streamsize xsputn(const char* text, std::streamsize count) override {
+            out.append(text, static_cast<std::size_t>(count));
+            return count;
+        }
+    };
+
+    /// The output buffer of the string benchmarks. It is reserved once up front, so that (cleared every 1024 operations)
+    /// it never grows during a measurement and any allocation that is counted comes from the measured code.
+    std::string& scratch(){
+        static std::string buffer;
+        return buffer;
+    }
+
+    struct Measurement {
+        std::string name;
+        std::uint64_t iterations;       // Per sample.
+        double ns_per_op;
+        double bytes_per_op;
+        double allocs_per_op;
+    };
+
+    /// A benchmark body runs `iterations` operations and returns the number of bytes they produced (0 if not applicable).
+    using Body = std::function<std::size_t(std::uint64_t iterations)>;
+
+    struct Options {
+        std::string format = "text";
+        std::string filter;
+        std::string label;
+        double min_time_ms = 20.0;
+        bool check_allocs = false;
+    };
+
+    Measurement measure(const std::string& name, const Body& body, const Options& options){
+        using clock = std::chrono::steady_clock;
+        std::uint64_t allocations = 0;
+        auto run = [&](std::uint64_t iterations, std::size_t& bytes){
+            const std::uint64_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+            const auto start = clock::now();
+            bytes = body(iterations);
+            const auto stop = clock::now();
+            allocations += allocation_count.load(std::memory_order_relaxed) - allocations_before;
+            return std::chrono::duration<double, std::nano>(stop - start).count();
+        };
+
+        // Calibrate: grow the iteration count until a sample takes at least `min_time_ms`.
+        std::size_t bytes = 0;
+        std::uint64_t iterations = 1;
+        const double min_time_ns = options.min_time_ms * 1e6;
+        for(double elapsed = run(iterations, bytes); elapsed < min_time_ns; elapsed = run(iterations, bytes)){
+            const double factor = elapsed > 0.0 ? std::min(min_time_ns * 1.2 / elapsed, 10.0) : 10.0;
+            iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * std::max(factor, 1.5));
+        }
+
+        // Only the allocations of the samples are counted; the calibration runs double as warm-up.
+        constexpr int samples = 7;
+        double times[samples];
+        allocations = 0;
+        for(double& time : times) time = run(iterations, bytes) / static_cast<double>(iterations);
+        std::nth_element(times, times + samples / 2, times + samples);
+        return Measurement{name, iterations, times[samples / 2], static_cast<double>(bytes) / static_cast<double>(iterations),
+                           static_cast<double>(allocations) / (static_cast<double>(iterations) * samples)};
+    }
+
+    // --- Benchmark bodies ---
+
+    template<typename Printable>
+    Body streamToNull(const Printable& value){
+        return [&value](std::uint64_t iterations) -> std::size_t {
+            static Null_Buffer buffer;
+            std::ostream os(&buffer);
+            for(std::uint64_t i = 0; i < iterations; ++i) os<< value;
+            return 0;
+        };
+    }
+
+    template<typename Printable>
+    Body streamToString(const Printable& value){
+        return [&value](std::uint64_t iterations) -> std::size_t {
+            std::string& out = scratch();
+            out.clear();
+            String_Buffer buffer(out);
+            std::ostream os(&buffer);
+            std::size_t bytes = 0;
+            for(std::uint64_t i = 0; i < iterations; ++i){
+                os<< value;
+                // Keep the buffer small, so the measurement doesn't turn in to one of memory bandwidth.
+                if((i & 1023) == 1023){
+                    bytes += out.size();
+                    out.clear();
+                }
+            }
+            return bytes + out.size();
+        };
+    }
+
+#if ANSICOLORS_BENCH_FORMAT
+    template<typename Formattable>
+    Body formatToString(const Formattable& value){
+        return [&value](std::uint64_t iterations) -> std::size_t {
+            std::string& out = scratch();
+            out.clear();
+            std::size_t bytes = 0;
+            for(std::uint64_t i = 0; i < iterations; ++i){
+                std::format_to(std::back_inserter(out), "{}", value);
+                if((i & 1023) == 1023){
+                    bytes += out.size();
+                    out.clear();
+                }
+            }
+            return bytes + out.size();
+        };
+    }
+#endif
+
+    /// Indexes `palette` with every valid index (1 - `count`) in turn.
+    template<typename Palette>
+    Body indexPalette(const Palette& palette, uint8_t count, bool use_at){
+        return [&palette, count, use_at](std::uint64_t iterations) -> std::size_t {
+            uint8_t index = 1;
+            for(std::uint64_t i = 0; i < iterations; ++i){
+                const Color& color = use_at ? palette.at(index) : palette[index];
+                keep(color);
+                index = index == count ? 1 : index + 1;
+            }
+            return 0;
+        };
+    }
+
+    /// One operation is one full pass over the range of `palette`.
+    template<typename Palette>
+    Body iteratePalette(const Palette& palette){
+        return [&palette](std::uint64_t iterations) -> std::size_t {
+            for(std::uint64_t i = 0; i < iterations; ++i){
+                for(const Color& color : palette) keep(color);
+            }
+            return 0;
+        };
+    }
+
+    struct Benchmark {
+        std::string name;
+        Body body;
+    };
+
+    std::vector<Benchmark> allBenchmarks(){
+        const Color& red = fg::PrimaryColors.Red.Pure_Red;
+        const Color& on_blue = bg::PrimaryColors.Blue.Navy_Blue;
+        std::vector<Benchmark> benchmarks = {
+            {"color/stream_null/fg", streamToNull(red)},
+            {"color/stream_null/bg", streamToNull(on_blue)},
+            {"color/stream_string/fg", streamToString(red)},
+            {"color/stream_string/bg", streamToString(on_blue)},
+            {"color/c_str", [&red](std::uint64_t iterations) -> std::size_t {
+                std::size_t bytes = 0;
+                for(std::uint64_t i = 0; i < iterations; ++i){
+                    const Color* color = &red;
+                    keep(color);                // Hide the color, so the table lookup isn't folded.
+                    const char* sequence = color->c_str();
+                    keep(sequence);
+                    bytes += std::strlen(sequence);
+                }
+                return bytes;
+            }},
+            {"rgb_to_ansi256", [](std::uint64_t iterations) -> std::size_t {
+                for(std::uint64_t i = 0; i < iterations; ++i){
+                    const uint8_t code = rgb_to_ansi256(static_cast<uint8_t>(i * 7), static_cast<uint8_t>(i * 13), static_cast<uint8_t>(i * 29));
+                    keep(code);
+                }
+                return 0;
+            }},
+            {"rgb_to_ansi256_batch", [](std::uint64_t iterations) -> std::size_t {
+                // One operation is one color, converted in batches of 256.
+                uint8_t rgb[3 * 256], codes[256];
+                for(int i = 0; i < 3 * 256; ++i) rgb[i] = static_cast<uint8_t>(i * 7);
+                for(std::uint64_t done = 0; done < iterations; done += 256){
+                    keep(rgb);
+                    rgb_to_ansi256_batch(rgb, codes, iterations - done < 256 ? static_cast<std::size_t>(iterations - done) : 256);
+                    keep(codes[0]);
+                }
+                return 0;
+            }},
+            {"parse_ansi256_colors", [](std::uint64_t iterations) -> std::size_t {
+                // One operation is one value (#rrggbb, every 16th one rgb(r, g, b)), parsed in batches of 256.
+                static char text[256][24];
+                static std::string_view values[256];
+                for(int i = 0; i < 256; ++i){
+                    const int length = i % 16 == 5 ? std::snprintf(text[i], sizeof(text[i]), "rgb(%d, %d, %d)", i, 255 - i, i / 2)
+                                                   : std::snprintf(text[i], sizeof(text[i]), "#%06x", i * 65793 % 0x1000000);
+                    values[i] = std::string_view(text[i], static_cast<std::size_t>(length));
+                }
+                uint8_t codes[256];
+                for(std::uint64_t done = 0; done < iterations; done += 256){
+                    keep(values);
+                    const std::size_t parsed = parse_ansi256_colors(values, iterations - done < 256 ? static_cast<std::size_t>(iterations - done) : 256, codes);
+                    keep(parsed);
+                }
+                return 0;
+            }},
+            {"contrast/best_readable_fg", [](std::uint64_t iterations) -> std::size_t {
+                for(std::uint64_t i = 0; i < iterations; ++i){
+                    const uint8_t code = best_readable_fg(static_cast<uint8_t>(i), Color_Category::Cyan);
+                    keep(code);
+                }
+                return 0;
+            }},
+            {"contrast/best_readable_fg/palette", [](std::uint64_t iterations) -> std::size_t {
+                for(std::uint64_t i = 0; i < iterations; ++i){
+                    const Color color = best_readable_fg(static_cast<uint8_t>(i), fg::SecondaryColors.Cyan);
+                    keep(color);
+                }
+                return 0;
+            }},
+            {"nearest_in/category", [](std::uint64_t iterations) -> std::size_t {
+                for(std::uint64_t i = 0; i < iterations; ++i){
+                    const uint8_t code = nearest_in(Color_Category::Green, static_cast<uint8_t>(i * 7), static_cast<uint8_t>(i * 13), static_cast<uint8_t>(i * 29));
+                    keep(code);
+                }
+                return 0;
+            }},
+            {"nearest_in/palette", [](std::uint64_t iterations) -> std::size_t {
+                for(std::uint64_t i = 0; i < iterations; ++i){
+                    const Color color = nearest_in(fg::PrimaryColors.Blue, static_cast<uint8_t>(i * 7), static_cast<uint8_t>(i * 13), static_cast<uint8_t>(i * 29));
+                    keep(color);
+                }
+                return 0;
+            }},
+            {"palette/index/red", indexPalette(fg::PrimaryColors.Red, 11, false)},
+            {"palette/at/red", indexPalette(fg::PrimaryColors.Red, 11, true)},
+            {"palette/index/green", indexPalette(fg::PrimaryColors.Green, 48, false)},
+            {"palette/at/green", indexPalette(fg::PrimaryColors.Green, 48, true)},
+            {"palette/index/gray", indexPalette(fg::GrayScaleColors.Gray, 24, false)},
+            {"palette/at/gray", indexPalette(fg::GrayScaleColors.Gray, 24, true)},
+            {"palette/range_index/red", indexPalette(*fg::PrimaryColors.Red.operator->(), 11, false)},
+            {"iterate/red", iteratePalette(fg::PrimaryColors.Red)},
+            {"iterate/green", iteratePalette(fg::PrimaryColors.Green)},
+            {"iterate/gray", iteratePalette(fg::GrayScaleColors.Gray)},
+        };
+#if ANSICOLORS_BENCH_FORMAT
+        benchmarks.push_back({"format/color", formatToString(red)});
+        benchmarks.push_back({"format/red", formatToString(fg::PrimaryColors.Red)});
+        benchmarks.push_back({"format/green", formatToString(fg::PrimaryColors.Green)});
+        benchmarks.push_back({"format/blue", formatToString(fg::PrimaryColors.Blue)});
+        benchmarks.push_back({"format/cyan", formatToString(fg::SecondaryColors.Cyan)});
+        benchmarks.push_back({"format/yellow", formatToString(fg::SecondaryColors.Yellow)});
+        benchmarks.push_back({"format/purple", formatToString(fg::SecondaryColors.Purple)});
+        benchmarks.push_back({"format/orange", formatToString(fg::TertiaryColors.Orange)});
+        benchmarks.push_back({"format/brown", formatToString(fg::TertiaryColors.Brown)});
+        benchmarks.push_back({"format/violet", formatToString(fg::TertiaryColors.Violet)});
+        benchmarks.push_back({"format/pink", formatToString(fg::TertiaryColors.Pink)});
+        benchmarks.push_back({"format/black", formatToString(fg::GrayScaleColors.Black)});
+        benchmarks.push_back({"format/gray", formatToString(fg::GrayScaleColors.Gray)});
+        benchmarks.push_back({"format/white", formatToString(fg::GrayScaleColors.White)});
+#endif
+        return benchmarks;
+    }
+
+    // --- Output ---
+
+    std::string jsonEscaped(const std::string& text){
+        std::string escaped;
+        for(char c : text){
+            if(c == '"' || c == '\\') escaped += '\\';
+            if(static_cast<unsigned char>(c) < 0x20) continue;
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    const char* compilerName(){
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc";
+#else
+        return "unknown";
+#endif
+    }
+
+    void print(const std::vector<Measurement>& results, const Options& options){
+        if(options.format == "json"){
+            std::printf("{\n  \"label\": \"%s\",\n  \"compiler\": \"%s\",\n  \"cplusplus\": %ld,\n  \"benchmarks\": [\n",
+                        jsonEscaped(options.label).c_str(), jsonEscaped(compilerName()).c_str(), static_cast<long>(__cplusplus));
+            for(std::size_t i = 0; i < results.size(); ++i){
+                const Measurement& result = results[i];
+                std::printf("    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"bytes_per_op\": %.3f, \"allocs_per_op\": %.6f}%s\n",
+                            result.name.c_str(), static_cast<unsigned long long>(result.iterations), result.ns_per_op,
+                            result.bytes_per_op, result.allocs_per_op, i + 1 == results.size() ? "" : ",");
+            }
+            std::printf("  ]\n}\n");
+        } else if(options.format == "csv"){
+            std::printf("label,name,iterations,ns_per_op,bytes_per_op,allocs_per_op\n");
+            for(const Measurement& result : results){
+                std::printf("%s,%s,%llu,%.3f,%.3f,%.6f\n", options.label.c_str(), result.name.c_str(),
+                            static_cast<unsigned long long>(result.iterations), result.ns_per_op, result.bytes_per_op, result.allocs_per_op);
+            }
+        } else {
+            std::printf("%-28s %14s %12s %12s %12s\n", "benchmark", "iterations", "ns/op", "bytes/op", "allocs/op");
+            for(const Measurement& result : results){
+                std::printf("%-28s %14llu %12.2f %12.2f %12.4f\n", result.name.c_str(),
+                            static_cast<unsigned long long>(result.iterations), result.ns_per_op, result.bytes_per_op, result.allocs_per_op);
+            }
+        }
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options){
+        for(int i = 1; i < argc; ++i){
+            const std::string argument = argv[i];
+            auto value = [&argument](const char* prefix) -> const char* {
+                const std::size_t length = std::strlen(prefix);
+                return argument.compare(0, length, prefix) == 0 ? argument.c_str() + length : nullptr;
+            };
+            if(const char* format = value("--format=")) options.format = format;
+            else if(const char* filter = value("--filter=")) options.filter = filter;
+            else if(const char* label = value("--label=")) options.label = label;
+            else if(const char* min_time = value("--min-time=")) options.min_time_ms = std::atof(min_time);
+            else if(argument == "--check-allocs") options.check_allocs = true;
+            else return false;
+        }
+        return (options.format == "text" || options.format == "json" || options.format == "csv") && options.min_time_ms > 0.0;
+    }
+}
+
+int main(int argc, char** argv){
+    Options options;
+    if(!parseOptions(argc, argv, options)){
+        std::fprintf(stderr, "Usage: %s [--format=text|json|csv] [--filter=<substring>] [--min-time=<ms>] [--label=<text>] [--check-allocs]\n", argv[0]);
+        return 2;
+    }
+    scratch().reserve(std::size_t(1) << 16);
+    std::vector<Measurement> results;
+    for(const Benchmark& benchmark : allBenchmarks()){
+        if(benchmark.name.find(options.filter) == std::string::npos) continue;
+        results.push_back(measure(benchmark.name, benchmark.body, options));
+    }
+    print(results, options);
+
+    int status = 0;
+    if(options.check_allocs){
+        for(const Measurement& result : results){
+            if(result.allocs_per_op == 0.0) continue;
+            std::fprintf(stderr, "ALLOCATES: %s (%.4f allocations per operation)\n", result.name.c_str(), result.allocs_per_op);
+            status = 1;
+        }
+    }
+    return status;
+}
@@ -0,0 +1,58 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Measures the number of bytes a progress bar update puts on the wire:
+// the incremental `Progress_Bar` versus rewriting the whole line with `Color` objects on every update.
+//
+// Build: g++ -std=c++17 -O2 -I include bench/ProgressBarBench.cpp -o progress_bar_bench
+//        or with CMake: -DANSICOLORS_BUILD_BENCHMARKS=ON, target `progress_bar_bench`
+
+#include "AnsiColors.hpp"
+#include "AnsiColorsProgress.hpp"
+#include <cstdio>
+#include <sstream>
+
+using namespace ansi_colors;
+
+namespace {
+    /// The naive approach: carriage return, every cell streamed with its `Color`, then the percentage.
+    std::size_t fullRedrawBytes(unsigned width, double fraction){
+        std::ostringstream line;
+        line<< '\r';
+        const unsigned filled = static_cast<unsigned>(fraction * width);
+        for(unsigned cell = 0; cell < width; ++cell){
+            line<< (cell < filled ? fg::PrimaryColors.Green.Lime_Green : fg::GrayScaleColors.Shades.Shade6)
+                << (cell < filled ? "█" : "░");
+        }
+        line<< Reset::FgColor<< ' '<< static_cast<int>(fraction * 100.0)<< '%';
+        return line.str().size();
+    }
+
+    void run(const char* name, unsigned width, unsigned updates, bool gradient){
+        constexpr auto scale = make_gradient<16>(Defined_Color_Values::Red::Red52, Defined_Color_Values::Yellow::Yellow226,
+                                                 Defined_Color_Values::Green::Green46);
+        Progress_Bar bar = gradient ? Progress_Bar(1, 1, width, scale) : Progress_Bar(1, 1, width, uint8_t{40});
+        std::string out;
+        std::size_t incremental = 0, full = 0;
+        const auto start = std::chrono::steady_clock::time_point{} + std::chrono::hours(1);
+        for(unsigned update = 0; update <= updates; ++update){
+            const double fraction = static_cast<double>(update) / updates;
+            out.clear();
+            // Every update lands in its own frame, so the rate limiter never drops one.
+            bar.update(fraction, out, start + update * Terminal_Refresh_Interval);
+            incremental += out.size();
+            full += fullRedrawBytes(width, fraction);
+        }
+        std::printf("%-22s width=%3u updates=%5u  incremental=%7.1f B/update  full_redraw=%7.1f B/update  ratio=%5.1fx\n",
+                    name, width, updates, static_cast<double>(incremental) / (updates + 1),
+                    static_cast<double>(full) / (updates + 1), static_cast<double>(full) / static_cast<double>(incremental));
+    }
+}
+
+int main(){
+    run("solid, coarse steps", 40, 100, false);
+    run("solid, fine steps", 40, 10000, false);
+    run("gradient, coarse", 80, 100, true);
+    run("gradient, fine steps", 80, 10000, true);
+    return 0;
+}
@@ -0,0 +1,89 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Compares a raw ANSI capture of a colored log session with the same session as a recording (AnsiColorsRecording.hpp):
+// the size on disk, and the time to render a 4 KiB window at a random (plain text) offset. The raw capture has to be
+// parsed from the start to find the offset and the style state there; the recording seeks.
+//
+// Build: g++ -std=c++17 -O2 -pthread -I include bench/RecordingBench.cpp -o recording_bench
+//        or with CMake: -DANSICOLORS_BUILD_BENCHMARKS=ON, target `recording_bench`
+
+#include "AnsiColorsRecording.hpp"
+#include "AnsiColorsPalette.hpp"
+#include "AnsiColorsStream.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <sstream>
+
+using namespace ansi_colors;
+
+namespace {
+    /// About `lines` log lines, colored the way an application colors them: `Color` objects streamed per field.
+    std::string makeCapture(std::size_t lines){
+        static const char* const levels[] = {"INFO ", "DEBUG", "WARN ", "ERROR"};
+        const Color* const colors[] = {&fg::PrimaryColors.Green.Lime_Green, &fg::GrayScaleColors.Gray[12],
+                                       &fg::TertiaryColors.Orange.Amber, &fg::PrimaryColors.Red.Pure_Red};
+        std::mt19937 random(42);
+        std::ostringstream capture;
+        for(std::size_t line = 0; line < lines; ++line){
+            const unsigned level = random() % 4;
+            capture<< fg::GrayScaleColors.Gray[8]<< "2025-06-01T12:00:"<< (line % 60)<< "Z "<< Reset::All
+                   << *colors[level]<< TextStyle::Bold<< levels[level]<< Reset::All
+                   << " request "<< fg::SecondaryColors.Cyan.Dark_Turquoise<< "id="<< random()<< Reset::All
+                   << " handled in "<< (random() % 900)<< "ms\n";
+        }
+        return capture.str();
+    }
+
+    /// Renders `size` plain text bytes from `offset` by scanning the raw capture from the start.
+    std::size_t renderRaw(const std::string& capture, std::size_t offset, std::size_t size){
+        std::size_t plain = 0, position = 0;
+        for(; position < capture.size() && plain < offset; ++position){
+            if(capture[position] == '\033'){
+                while(++position < capture.size() && !(capture[position] >= 0x40 && capture[position] <= 0x7E && capture[position] != '['));
+            } else {
+                ++plain;
+            }
+        }
+        // Everything from here on can be copied as is (the style state would have to be replayed as well).
+        std::size_t end = position;
+        for(std::size_t copied = 0; end < capture.size() && copied < size; ++end){
+            if(capture[end] != '\033') ++copied;
+        }
+        return end - position;
+    }
+}
+
+int main(){
+    const std::string capture = makeCapture(400000);
+    Recording_Writer writer;
+    writer.write_ansi(capture);
+    const std::string path = "recording_bench.lmnrec";
+    writer.save(path);
+    const Recording recording(path);
+    std::printf("raw capture: %10zu bytes\nrecording:   %10zu bytes (%.2fx smaller; %zu styles, %zu runs)\n",
+                capture.size(), writer.serialize().size(), double(capture.size()) / double(writer.serialize().size()),
+                recording.style_size(), recording.run_size());
+
+    std::mt19937 random(7);
+    std::size_t sink = 0;
+    const int windows = 200;
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < windows; ++i) sink += renderRaw(capture, random() % recording.text().size(), 4096);
+    const std::chrono::duration<double, std::micro> raw = std::chrono::steady_clock::now() - start;
+
+    std::string out;
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < windows; ++i){
+        const std::size_t offset = random() % recording.text().size();
+        out.clear();
+        recording.render(out, Color_Depth::Ansi256, offset, offset + 4096);
+        sink += out.size();
+    }
+    const std::chrono::duration<double, std::micro> seek = std::chrono::steady_clock::now() - start;
+    std::printf("render a 4 KiB window: raw scan %10.1f us, recording %8.1f us (%.0fx faster)  [%zu]\n",
+                raw.count() / windows, seek.count() / windows, raw.count() / seek.count(), sink);
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/bin/sh
+# Copyright: (c) 2025 Thomas Olijnsma
+# License: MIT: see LICENSE for more details
+
+# Measures the cost of including a header in a whole project: compiles 100 translation units that each include it and use
+# one palette color (at -O2, JOBS in parallel), then links them. Reports the wall time of the compilation, the summed object
+# size (text + data + bss), and the size of the linked executable.
+#
+# Usage: bench/compile_100.sh [compiler] [std] [header]  (defaults: c++, c++17, AnsiColorsPalette.hpp; set JOBS, default 1)
+
+CXX=${1:-c++}
+STD=${2:-c++17}
+HEADER=${3:-AnsiColorsPalette.hpp}
+JOBS=${JOBS:-1}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+i=0
+while [ "$i" -lt 100 ]; do
+    printf '#include "%s"\nconst char* color_%d(){ return ansi_colors::fg::PrimaryColors.Red.Pure_Red.c_str(); }\n' "$HEADER" "$i" > "$TMP/tu_$i.cpp"
+    i=$((i + 1))
+done
+printf 'int main(){ return 0; }\n' > "$TMP/main.cpp"
+
+start=$(date +%s%N)
+ls "$TMP"/*.cpp | xargs -P "$JOBS" -I {} "$CXX" -std="$STD" -O2 -c -I "$ROOT/include" {} -o {}.o || exit 1
+elapsed=$(( ($(date +%s%N) - start) / 1000000 ))
+"$CXX" "$TMP"/*.o -o "$TMP/a.out" || exit 1
+
+objects=$(size "$TMP"/tu_*.o | awk 'NR > 1 { total += $4 } END { print total }')
+printf '%-28s %12s %18s %16s\n' header "ms (100 TUs)" "object bytes" "binary bytes"
+printf '%-28s %12s %18s %16s\n' "$HEADER" "$elapsed" "$objects" "$(wc -c < "$TMP/a.out")"
@@ -0,0 +1,42 @@
+#!/bin/sh
+# Copyright: (c) 2025 Thomas Olijnsma
+# License: MIT: see LICENSE for more details
+
+# Reports what the std::format integration costs in binary size, before and after a change: compiles one translation unit
+# that formats every palette (foreground and background, `char` and `wchar_t`) against the headers of git revision BASE and
+# against the working tree (at -O2), and prints the `size` of both objects and linked executables.
+# Needs a C++20 standard library with <format>.
+#
+# Usage: bench/format_size.sh [compiler] [base]      (defaults: c++, the first commit: one formatter per palette)
+
+CXX=${1:-c++}
+BASE=${2:-$(git -C "$(dirname "$0")" rev-list --max-parents=0 HEAD)}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+mkdir "$TMP/base"
+git -C "$ROOT" archive "$BASE" include | tar -x -C "$TMP/base" || exit 1
+
+{
+    printf '#include "AnsiColors.hpp"\n#include <format>\n#include <string>\nusing namespace ansi_colors;\n'
+    printf 'template<typename T> std::size_t both(const T& palette){\n'
+    printf '    return std::format("{}", palette).size() + std::format(L"{}", palette).size();\n}\n'
+    printf 'int main(){\n    std::size_t total = 0;\n'
+    for side in fg bg; do
+        for palette in PrimaryColors.Red PrimaryColors.Green PrimaryColors.Blue SecondaryColors.Cyan SecondaryColors.Yellow \
+                       SecondaryColors.Purple TertiaryColors.Orange TertiaryColors.Brown TertiaryColors.Violet TertiaryColors.Pink \
+                       GrayScaleColors.Black GrayScaleColors.Gray GrayScaleColors.White; do
+            printf '    total += both(%s::%s);\n' "$side" "$palette"
+        done
+    done
+    printf '    return static_cast<int>(total & 1);\n}\n'
+} > "$TMP/tu.cpp"
+
+printf '%-10s %10s %10s %10s %12s\n' tree text data bss executable
+for tree in base work; do
+    if [ "$tree" = base ]; then include="$TMP/base/include"; else include="$ROOT/include"; fi
+    "$CXX" -std=c++20 -O2 -c -I "$include" "$TMP/tu.cpp" -o "$TMP/$tree.o" || exit 1
+    "$CXX" "$TMP/$tree.o" -o "$TMP/$tree" || exit 1
+    size "$TMP/$tree.o" | awk -v tree="$tree" -v exe="$(wc -c < "$TMP/$tree")" 'NR == 2 { printf "%-10s %10s %10s %10s %12s\n", tree, $1, $2, $3, exe }'
+done
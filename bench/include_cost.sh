@@ -0,0 +1,30 @@
+#!/bin/sh
+# Copyright: (c) 2025 Thomas Olijnsma
+# License: MIT: see LICENSE for more details
+
+# Measures what including each public header costs a translation unit: the front-end time (-fsyntax-only, averaged over
+# RUNS compilations) and whether it adds the static initialization of <iostream> (a reference to std::ios_base::Init).
+#
+# Usage: bench/include_cost.sh [compiler] [std]      (defaults: c++, c++17; set RUNS to change the number of runs, default 10)
+
+CXX=${1:-c++}
+STD=${2:-c++17}
+RUNS=${RUNS:-10}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+printf '%-28s %12s %18s\n' header "ms/TU" "ios_base::Init"
+for header in AnsiColorsCore.hpp AnsiColorsPalette.hpp AnsiColorsStream.hpp AnsiColorsFormat.hpp AnsiColors.hpp; do
+    printf '#include "%s"\nint main(){ return ansi_colors::rgb_to_ansi256(1, 2, 3); }\n' "$header" > "$TMP/tu.cpp"
+    start=$(date +%s%N)
+    i=0
+    while [ "$i" -lt "$RUNS" ]; do
+        "$CXX" -std="$STD" -fsyntax-only -I "$ROOT/include" "$TMP/tu.cpp" || exit 1
+        i=$((i + 1))
+    done
+    elapsed=$(( ($(date +%s%N) - start) / 1000000 / RUNS ))
+    "$CXX" -std="$STD" -O2 -c -I "$ROOT/include" "$TMP/tu.cpp" -o "$TMP/tu.o" || exit 1
+    if nm -C "$TMP/tu.o" | grep -q 'ios_base::Init'; then init=yes; else init=no; fi
+    printf '%-28s %12s %18s\n' "$header" "$elapsed" "$init"
+done
@@ -0,0 +1,337 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_CELL_HPP
+#define LEMONCODE_ANSICOLORS_CELL_HPP
+
+#include "AnsiColorsCursor.hpp"
+#include "AnsiColorsInfo.hpp"
+#include "AnsiColorsVision.hpp"
+#include <string_view>
+#include <cstring>
+#include <new>
+#include <memory>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The color capability of an output sink (e.g. a terminal, a log file or a pipe).
+    enum class Color_Depth : uint8_t {
+        /// @brief No escape sequences at all: plain text.
+        None,
+        /// @brief The 16 basic colors (SGR 30 – 37, 90 – 97); other codes are mapped to the nearest of them.
+        Ansi16,
+        /// @brief The ANSI 256 colors (SGR 38;5;n).
+        Ansi256,
+        /// @brief 24 bit colors (SGR 38;2;r;g;b), with the xterm RGB values of the codes (see `Color_Table`).
+        TrueColor
+    };
+}
+
+/// @brief Helper namespace for the cell styles.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_cell_helper_ {
+    /// @brief Maps every color code to the nearest of the 16 basic colors (0 – 15), by RGB distance.
+    struct Ansi16_Map {
+        uint8_t codes[256] {};
+
+        constexpr Ansi16_Map() noexcept {
+            using ansi_colors::Color_Table;
+            for(int code = 0; code < 256; ++code){
+                int best = 0, best_distance = 3 * 256 * 256;
+                for(int basic = 0; basic < 16 && code >= 16; ++basic){
+                    const int dr = Color_Table::red[code] - Color_Table::red[basic],
+                              dg = Color_Table::green[code] - Color_Table::green[basic],
+                              db = Color_Table::blue[code] - Color_Table::blue[basic];
+                    const int distance = dr*dr + dg*dg + db*db;
+                    if(distance < best_distance){
+                        best_distance = distance;
+                        best = basic;
+                    }
+                }
+                codes[code] = static_cast<uint8_t>(code < 16 ? code : best);
+            }
+        }
+    };
+
+    inline constexpr Ansi16_Map ansi16 {};
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Interface for packed cell styles: foreground code, background code and text style attributes in one `uint32_t`.
+    ///
+    /// Bits 0 – 7 hold the foreground code, bits 8 – 15 the background code, bits 16 – 23 the attributes,
+    /// and bits 24/25 mark whether the foreground/background is set (unset means the terminal default color).
+    /// Styles are combined with `|`, e.g. `Cell_Style::fg(196) | Cell_Style::bg(234) | Cell_Style::Bold`.
+    struct Cell_Style {
+        Cell_Style() noexcept = delete;
+
+        /// @brief The terminal default colors without attributes.
+        inline static constexpr uint32_t Default =          0;
+
+        inline static constexpr uint32_t Bold =             1u << 16;
+        inline static constexpr uint32_t Faint =            1u << 17;
+        inline static constexpr uint32_t Italic =           1u << 18;
+        inline static constexpr uint32_t Underline =        1u << 19;
+        inline static constexpr uint32_t Blink =            1u << 20;
+        inline static constexpr uint32_t Inverse =          1u << 21;
+        inline static constexpr uint32_t Hidden =           1u << 22;
+        inline static constexpr uint32_t Strikethrough =    1u << 23;
+
+        inline static constexpr uint32_t FgSet =            1u << 24;
+        inline static constexpr uint32_t BgSet =            1u << 25;
+        inline static constexpr uint32_t AttributeMask =    0x00FF0000u;
+
+        /// @brief Returns the style bits of a foreground color code.
+        static constexpr uint32_t fg(uint8_t code) noexcept { return FgSet | code; }
+
+        /// @brief Returns the style bits of a background color code.
+        static constexpr uint32_t bg(uint8_t code) noexcept { return BgSet | (static_cast<uint32_t>(code) << 8); }
+
+        /// @brief Returns the style bits of a `Color`, as foreground or background depending on the color.
+        static constexpr uint32_t from(const Color& color) noexcept {
+            return color.isBackgroundColor() ? bg(color.colorCode()) : fg(color.colorCode());
+        }
+
+        static constexpr uint8_t fg_code(uint32_t style) noexcept { return static_cast<uint8_t>(style); }
+        static constexpr uint8_t bg_code(uint32_t style) noexcept { return static_cast<uint8_t>(style >> 8); }
+
+        /// @brief Appends the shortest SGR sequence that changes the terminal from style `from` to style `to`.
+        ///        Removed attributes are switched off with their own reset codes (see `Reset`), so no full reset is needed.
+        /// @param out The buffer to append to. Nothing is appended if both styles are equal.
+        /// @param depth The color capability of the sink; the colors are written as 16, 256 or 24 bit colors, and
+        ///              `Color_Depth::None` appends nothing at all. Default = `Color_Depth::Ansi256`.
+        /// @param vision The color vision of the viewer; the color codes are remapped with `color_vision_map()`. Default = `Color_Vision::Normal`.
+        static void append_transition(std::string& out, uint32_t from, uint32_t to, Color_Depth depth = Color_Depth::Ansi256,
+                                      Color_Vision vision = Color_Vision::Normal){
+            if(from == to || depth == Color_Depth::None) return;
+            // SGR parameters that switch an attribute on and off, indexed by attribute bit.
+            constexpr unsigned on[8] =  {1, 2, 3, 4, 5, 7, 8, 9};
+            constexpr unsigned off[8] = {22, 22, 23, 24, 25, 27, 28, 29};
+
+            out += "\033[";
+            bool first = true;
+            auto parameter = [&out, &first](unsigned value){
+                if(!first) out += ';';
+                Cursor::append_number(out, value);
+                first = false;
+            };
+
+            uint32_t added = (to & ~from) & AttributeMask;
+            const uint32_t removed = (from & ~to) & AttributeMask;
+            for(unsigned bit = 0; bit < 8; ++bit){
+                if(removed & (1u << (16 + bit))){
+                    if(bit == 1 && (removed & Bold)) continue;
+                    parameter(off[bit]);
+                    // Bold and faint share their reset code; restore the one that stays.
+                    if(bit < 2) added |= to & (Bold | Faint);
+                }
+            }
+            for(unsigned bit = 0; bit < 8; ++bit){
+                if(added & (1u << (16 + bit))) parameter(on[bit]);
+            }
+            const uint8_t* remap = color_vision_map(vision);
+            auto color = [&parameter, depth, remap](uint8_t code, bool bg_color){
+                code = remap[code];
+                if(depth == Color_Depth::Ansi16){
+                    const unsigned basic = __LMN_cell_helper_::ansi16.codes[code];
+                    parameter((bg_color ? 40u : 30u) + (basic < 8 ? basic : basic - 8 + 60));
+                } else if(depth == Color_Depth::TrueColor){
+                    parameter(bg_color ? 48 : 38); parameter(2);
+                    parameter(Color_Table::red[code]); parameter(Color_Table::green[code]); parameter(Color_Table::blue[code]);
+                } else {
+                    parameter(bg_color ? 48 : 38); parameter(5); parameter(code);
+                }
+            };
+            if((from ^ to) & (FgSet | 0xFFu)){
+                if(to & FgSet) color(fg_code(to), false);
+                else parameter(39);
+            }
+            if((from ^ to) & (BgSet | 0xFF00u)){
+                if(to & BgSet) color(bg_code(to), true);
+                else parameter(49);
+            }
+            out += 'm';
+        }
+
+        ~Cell_Style() noexcept = delete;
+    };
+
+    /// @brief A single character cell: a Unicode code point and a packed `Cell_Style`.
+    struct Cell {
+        char32_t glyph = U' ';
+        uint32_t style = Cell_Style::Default;
+
+        constexpr bool operator==(const Cell& other) const noexcept { return glyph == other.glyph && style == other.style; }
+        constexpr bool operator!=(const Cell& other) const noexcept { return !(*this == other); }
+    };
+
+    /// @brief A row-major grid of cells stored as a structure of arrays: all glyphs in one array, all styles in another.
+    ///
+    /// Every row starts on a 64-byte boundary (rows are padded to a multiple of 16 cells), so rows can be compared
+    /// with wide SIMD loads, and a scan over the styles never touches the glyph bytes (and vice versa).
+    /// Rows are kept in a ring, so `scroll()` (e.g. appending a line to a scrollback) doesn't move any cells.
+    class Cell_Grid {
+        struct Aligned_Delete {
+            void operator()(void* pointer) const noexcept { ::operator delete(pointer, std::align_val_t(alignment)); }
+        };
+        template<typename T>
+        using Aligned_Array = std::unique_ptr<T[], Aligned_Delete>;
+
+        template<typename T>
+        static Aligned_Array<T> allocate(std::size_t count){
+            return Aligned_Array<T>(static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignment))));
+        }
+
+        unsigned row_count, column_count, row_stride;
+        unsigned first_row = 0;
+        Aligned_Array<char32_t> glyphs;
+        Aligned_Array<uint32_t> styles;
+
+        std::size_t offset(unsigned row) const noexcept {
+            unsigned physical = first_row + row;
+            if(physical >= row_count) physical -= row_count;
+            return std::size_t(physical) * row_stride;
+        }
+    public:
+        /// @brief The alignment (in bytes) of every row.
+        inline static constexpr std::size_t alignment = 64;
+
+        Cell_Grid() = delete;
+
+        /// @brief Creates a grid of the given size with every cell set to `fill`.
+        Cell_Grid(unsigned rows, unsigned columns, Cell fill = Cell{})
+            : row_count(rows), column_count(columns), row_stride((columns + 15u) & ~15u),
+              glyphs(allocate<char32_t>(std::size_t(rows) * row_stride)), styles(allocate<uint32_t>(std::size_t(rows) * row_stride)){
+            // The padding cells are zeroed once, so whole (padded) rows can be compared.
+            std::memset(glyphs.get(), 0, std::size_t(rows) * row_stride * sizeof(char32_t));
+            std::memset(styles.get(), 0, std::size_t(rows) * row_stride * sizeof(uint32_t));
+            this->fill(fill);
+        }
+
+        Cell_Grid(Cell_Grid&&) noexcept = default;
+        Cell_Grid&operator=(Cell_Grid&&) noexcept = default;
+
+        unsigned rows() const noexcept { return row_count; }
+        unsigned columns() const noexcept { return column_count; }
+        /// @brief The distance (in cells) between the start of two rows; a multiple of 16.
+        unsigned stride() const noexcept { return row_stride; }
+
+        /// @brief Returns the glyphs of a row (`columns()` valid entries, `stride()` allocated), 64-byte aligned.
+        char32_t* glyph_row(unsigned row) noexcept { return glyphs.get() + offset(row); }
+        const char32_t* glyph_row(unsigned row) const noexcept { return glyphs.get() + offset(row); }
+
+        /// @brief Returns the packed styles of a row (`columns()` valid entries, `stride()` allocated), 64-byte aligned.
+        uint32_t* style_row(unsigned row) noexcept { return styles.get() + offset(row); }
+        const uint32_t* style_row(unsigned row) const noexcept { return styles.get() + offset(row); }
+
+        Cell at(unsigned row, unsigned column) const noexcept {
+            const std::size_t index = offset(row) + column;
+            return Cell{glyphs[index], styles[index]};
+        }
+
+        void set(unsigned row, unsigned column, Cell cell) noexcept {
+            const std::size_t index = offset(row) + column;
+            glyphs[index] = cell.glyph;
+            styles[index] = cell.style;
+        }
+
+        /// @brief Sets every cell of a row.
+        void fill_row(unsigned row, Cell cell) noexcept {
+            char32_t* glyph = glyph_row(row);
+            uint32_t* style = style_row(row);
+            for(unsigned column = 0; column < column_count; ++column){
+                glyph[column] = cell.glyph;
+                style[column] = cell.style;
+            }
+        }
+
+        /// @brief Sets every cell of the grid.
+        void fill(Cell cell) noexcept {
+            for(unsigned row = 0; row < row_count; ++row) fill_row(row, cell);
+        }
+
+        /// @brief Scrolls the grid up: row `count` becomes row 0 and the rows that come in at the bottom are set to `fill`.
+        ///        Only the ring start moves, no cells are copied.
+        void scroll(unsigned count, Cell fill = Cell{}) noexcept {
+            if(count > row_count) count = row_count;
+            first_row = static_cast<unsigned>((std::size_t(first_row) + count) % (row_count ? row_count : 1));
+            for(unsigned row = row_count - count; row < row_count; ++row) fill_row(row, fill);
+        }
+
+        /// @brief Compares the styles of a row with the same row of another grid of equal width.
+        bool styles_equal(const Cell_Grid& other, unsigned row) const noexcept {
+            return std::memcmp(style_row(row), other.style_row(row), std::size_t(row_stride) * sizeof(uint32_t)) == 0;
+        }
+
+        /// @brief Compares the glyphs of a row with the same row of another grid of equal width.
+        bool glyphs_equal(const Cell_Grid& other, unsigned row) const noexcept {
+            return std::memcmp(glyph_row(row), other.glyph_row(row), std::size_t(row_stride) * sizeof(char32_t)) == 0;
+        }
+
+        /// @brief Compares a row (glyphs and styles) with the same row of another grid of equal width.
+        bool row_equal(const Cell_Grid& other, unsigned row) const noexcept {
+            return styles_equal(other, row) && glyphs_equal(other, row);
+        }
+
+        /// @brief Returns the approximate memory used by the cells, in bytes.
+        std::size_t memory_usage() const noexcept {
+            return std::size_t(row_count) * row_stride * (sizeof(char32_t) + sizeof(uint32_t));
+        }
+
+        ~Cell_Grid() noexcept = default;
+    };
+}
+
+/// @brief Helper namespace for UTF-8 encoding and decoding of cell glyphs.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_utf8_helper_ {
+    /// @brief Appends the UTF-8 encoding of a code point.
+    inline void append(std::string& out, char32_t glyph){
+        if(glyph < 0x80){
+            out += static_cast<char>(glyph);
+        } else if(glyph < 0x800){
+            out += static_cast<char>(0xC0 | (glyph >> 6));
+            out += static_cast<char>(0x80 | (glyph & 0x3F));
+        } else if(glyph < 0x10000){
+            out += static_cast<char>(0xE0 | (glyph >> 12));
+            out += static_cast<char>(0x80 | ((glyph >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (glyph & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (glyph >> 18));
+            out += static_cast<char>(0x80 | ((glyph >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((glyph >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (glyph & 0x3F));
+        }
+    }
+
+    /// @brief Decodes the code point at the front of `text` and removes its bytes; invalid bytes decode as U+FFFD.
+    inline constexpr char32_t next(std::string_view& text) noexcept {
+        const unsigned char lead = static_cast<unsigned char>(text[0]);
+        const std::size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+        if(length == 0 || length > text.size()){
+            text.remove_prefix(1);
+            return U'�';
+        }
+        char32_t glyph = length == 1 ? lead : (lead & (0x7F >> length));
+        for(std::size_t i = 1; i < length; ++i){
+            const unsigned char continuation = static_cast<unsigned char>(text[i]);
+            if((continuation & 0xC0) != 0x80){
+                text.remove_prefix(i);
+                return U'�';
+            }
+            glyph = (glyph << 6) | (continuation & 0x3F);
+        }
+        text.remove_prefix(length);
+        return glyph;
+    }
+}
+
+#endif
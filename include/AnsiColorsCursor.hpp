@@ -0,0 +1,68 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_CURSOR_HPP
+#define LEMONCODE_ANSICOLORS_CURSOR_HPP
+
+#include "AnsiColorsCore.hpp"
+#include <string>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Interface for cursor control sequences, used by the incremental renderers to only redraw what changed.
+    struct Cursor {
+        Cursor() noexcept = delete;
+
+        inline static constexpr const char* Hide =      "\033[?25l";
+        inline static constexpr const char* Show =      "\033[?25h";
+        inline static constexpr const char* Save =      "\0337";
+        inline static constexpr const char* Restore =   "\0338";
+        /// @brief Moves the cursor to the top left corner (1, 1).
+        inline static constexpr const char* Home =      "\033[H";
+        /// @brief Erases the whole screen (the cursor position is not changed).
+        inline static constexpr const char* ClearScreen = "\033[2J";
+
+        /// @brief Appends a decimal number without going through std::to_string (no allocation besides the growth of `out`).
+        static void append_number(std::string& out, unsigned value){
+            char digits[10];
+            int length = 0;
+            do {
+                digits[length++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while(value != 0);
+            while(length > 0) out.push_back(digits[--length]);
+        }
+
+        /// @brief Appends the sequence that moves the cursor to an absolute position.
+        /// @param out The buffer to append to.
+        /// @param row The 1-based row.
+        /// @param column The 1-based column.
+        static void append_move_to(std::string& out, unsigned row, unsigned column){
+            out += "\033[";
+            append_number(out, row);
+            out += ';';
+            append_number(out, column);
+            out += 'H';
+        }
+
+        /// @brief Appends the ANSI 256 escape sequence of a color code, taken from the precomputed escape tables.
+        /// @param out The buffer to append to.
+        /// @param code The ANSI 256 color code.
+        /// @param bg_color If true, the background color is set; if false, the foreground color.
+        static void append_color(std::string& out, uint8_t code, bool bg_color){
+            using __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::getAnsi256Code;
+            out += getAnsi256Code(code, bg_color);
+        }
+
+        ~Cursor() noexcept = delete;
+    };
+}
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_FORMAT_HPP
+#define LEMONCODE_ANSICOLORS_FORMAT_HPP
+
+// The std::format integration (C++20): `std::formatter` specializations for `Color` and the palettes.
+
+#include "AnsiColorsPalette.hpp"
+#include "AnsiColorsWide.hpp"
+#if LEMONCODE_ANSICOLORS_INSTRUMENTATION
+    #include "AnsiColorsInstrument.hpp"
+#endif
+
+#if LEMONCODE_ANSICOLORS_CPP20_OR_NEWER
+    #include <concepts>
+    #include <format>
+    #include <string_view>
+
+    /// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+    namespace ansi_colors {
+        /// @brief Satisfied by the types that stand for a single color when they are formatted: the types with a
+        ///        `defaultColor()` that returns a `const Color&` (e.g. `fg::PrimaryColors.Red`, which formats as Pure_Red).
+        template<typename T>
+        concept Has_Default_Color = requires(const T& value){
+            { value.defaultColor() } -> std::same_as<const Color&>;
+        };
+    }
+
+    namespace std {
+        // Color formatter:
+        template<typename CharT>
+        struct formatter<ansi_colors::Color, CharT>{
+            std::formatter<std::basic_string_view<CharT>, CharT> base_fmt;
+
+            constexpr auto parse(basic_format_parse_context<CharT>& ctx){
+                return base_fmt.parse(ctx);
+            }
+
+            /// @brief Formats the same sequence as `operator<<`, copied from the constexpr `CharT` tables (AnsiColorsWide.hpp) in to
+            ///        a fixed buffer, so it never allocates nor converts characters.
+            template<typename FormatContext>
+            auto format(const ansi_colors::Color& col, FormatContext& ctx) const {
+            #if LEMONCODE_ANSICOLORS_INSTRUMENTATION
+                ansi_colors::__LMN_instrumentation_::formatter_calls.fetch_add(1, std::memory_order_relaxed);
+            #endif
+                typedef ansi_colors::Basic_Escape_Codes<CharT> Codes;
+                const std::basic_string_view<CharT> reset = col.isBackgroundColor() ? Codes::Reset::BgColor : Codes::Reset::FgColor;
+                const std::basic_string_view<CharT> code = Codes::color_code(col);
+                CharT buffer[32];
+                std::char_traits<CharT>::copy(buffer, reset.data(), reset.size());
+                std::char_traits<CharT>::copy(buffer + reset.size(), code.data(), code.size());
+                return base_fmt.format(std::basic_string_view<CharT>(buffer, reset.size() + code.size()), ctx);
+            }
+        };
+        // Palette formatter: one constrained formatter for everything that has a default color (the palettes of
+        // AnsiColorsPalette.hpp), which formats the precomputed escape sequence of that `defaultColor()`.
+        template<ansi_colors::Has_Default_Color Palette, typename CharT>
+        struct formatter<Palette, CharT> : formatter<ansi_colors::Color, CharT>{
+            template<typename FormatContext>
+            auto format(const Palette& palette, FormatContext& ctx) const {
+                return formatter<ansi_colors::Color, CharT>::format(palette.defaultColor(), ctx);
+            }
+        };
+    }
+#endif
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_GRADIENT_HPP
+#define LEMONCODE_ANSICOLORS_GRADIENT_HPP
+
+#include "AnsiColorsInfo.hpp"
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief A sequence of ANSI 256 color codes without adjacent duplicates, e.g. a gradient going from dark to light.
+    /// @tparam N The maximum number of steps.
+    template<std::size_t N>
+    struct Color_Scale {
+        uint8_t codes[N] = {};
+        std::size_t count = 0;
+
+        /// @brief Returns the number of (distinct) steps in the scale.
+        constexpr std::size_t size() const noexcept { return count; }
+
+        /// @brief Returns the color code of a step (valid range: 0 – size() - 1).
+        constexpr uint8_t operator[](std::size_t step) const noexcept { return codes[step]; }
+
+        /// @brief Maps a value in the range 0.0 – 1.0 (clamped) on to the scale, e.g. for heatmaps.
+        /// @return The color code of the step that covers the value.
+        constexpr uint8_t sample(double value) const noexcept {
+            if(!(value > 0.0)) return codes[0];
+            std::size_t step = static_cast<std::size_t>(value * static_cast<double>(count));
+            return codes[step < count ? step : count - 1];
+        }
+
+        constexpr const uint8_t* begin() const noexcept { return codes; }
+        constexpr const uint8_t* end() const noexcept { return codes + count; }
+    };
+}
+
+/// @brief Helper namespace for the compile time gradient generation.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_gradient_helper_ {
+    using ansi_colors::Color_Table;
+
+    /// @brief Finds the color code closest to the given CIE Lab value.
+    ///        Only the codes 16 – 255 are candidates: unlike the first 16 colors, their RGB values do not depend on the terminal theme.
+    inline constexpr uint8_t nearestLab(float L, float a, float b) noexcept {
+        int best = 16;
+        float best_distance = 3.0e38f;
+        for(int code = 16; code < 256; ++code){
+            float dL = Color_Table::lab_L[code] - L,
+                  da = Color_Table::lab_a[code] - a,
+                  db = Color_Table::lab_b[code] - b;
+            float distance = dL*dL + da*da + db*db;
+            if(distance < best_distance){
+                best_distance = distance;
+                best = code;
+            }
+        }
+        return static_cast<uint8_t>(best);
+    }
+
+    template<std::size_t N, std::size_t K>
+    constexpr ansi_colors::Color_Scale<N> interpolate(const uint8_t (&stops)[K]) noexcept {
+        static_assert(N >= 1, "A color scale needs at least one step.");
+        static_assert(K >= 2, "A gradient needs at least two colors.");
+        ansi_colors::Color_Scale<N> scale{};
+        for(std::size_t step = 0; step < N; ++step){
+            uint8_t code = stops[0];
+            if(step == N - 1 && N > 1){
+                code = stops[K - 1];
+            } else if(step != 0){
+                // Position of the step along the stops: segment index plus the fraction within that segment.
+                double position = static_cast<double>(step) * static_cast<double>(K - 1) / static_cast<double>(N - 1);
+                std::size_t segment = static_cast<std::size_t>(position);
+                float t = static_cast<float>(position - static_cast<double>(segment));
+                uint8_t from = stops[segment], to = stops[segment + 1];
+                code = nearestLab(Color_Table::lab_L[from] + (Color_Table::lab_L[to] - Color_Table::lab_L[from]) * t,
+                                  Color_Table::lab_a[from] + (Color_Table::lab_a[to] - Color_Table::lab_a[from]) * t,
+                                  Color_Table::lab_b[from] + (Color_Table::lab_b[to] - Color_Table::lab_b[from]) * t);
+            }
+            if(scale.count == 0 || scale.codes[scale.count - 1] != code){
+                scale.codes[scale.count++] = code;
+            }
+        }
+        return scale;
+    }
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Generates an N-step gradient through two or more colors, interpolated in the CIE Lab color space.
+    ///        Adjacent steps that map to the same color code are collapsed, so the scale can hold less than N codes.
+    ///        The first and last step are always the given end colors.
+    /// @code
+    /// constexpr auto heat = ansi_colors::make_gradient<16>(Defined_Color_Values::Red::Red52, Defined_Color_Values::Red::Red217);
+    /// std::cout<< ansi_colors::Color(heat.sample(0.75), false)<< "hot";
+    /// @endcode
+    /// @tparam N The number of steps.
+    /// @param stops The colors to pass through, as color codes, `Defined_Color_Values` or `Color` objects (the latter only at runtime).
+    /// @return A `Color_Scale` with the color codes of the gradient.
+    template<std::size_t N, typename... Colors>
+    constexpr Color_Scale<N> make_gradient(Colors... stops) noexcept {
+        const uint8_t codes[] = {static_cast<uint8_t>(stops)...};
+        return __LMN_gradient_helper_::interpolate<N>(codes);
+    }
+}
+
+#endif
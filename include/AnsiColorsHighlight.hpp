@@ -0,0 +1,188 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_HIGHLIGHT_HPP
+#define LEMONCODE_ANSICOLORS_HIGHLIGHT_HPP
+
+#include "AnsiColorsCore.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Highlights a (large) set of keywords in a single pass over the input, using an Aho–Corasick automaton.
+    ///
+    /// The keywords are compiled in to a deterministic automaton over byte classes (every byte that occurs in a keyword gets
+    /// its own class, all other bytes share one), so scanning costs one table lookup per input byte, independent of the number
+    /// of keywords. The escape sequence of every keyword is precomputed, and matches are spliced directly in to the output:
+    /// unmatched text is copied in bulk, without intermediate strings.
+    ///
+    /// Matches do not overlap; when keywords overlap the leftmost one wins, and of those starting at the same byte the longest
+    /// (like `Keyword_Rules` when longer keywords are added first). A match is only written once no longer keyword can still
+    /// extend it; the bytes after it are then scanned again. With `whole_words` (the default) a keyword only matches if it is
+    /// not directly preceded or followed by a letter, digit or '_'.
+    class Keyword_Highlighter {
+        struct Keyword {
+            std::string text;
+            std::string style;
+        };
+        std::vector<Keyword> keywords;
+        bool whole_words;
+
+        // The compiled automaton.
+        uint8_t byte_class[256] = {};
+        uint32_t class_count = 1;
+        std::vector<uint32_t> transitions;          // state * class_count + class -> state
+        std::vector<int32_t> keyword_at;            // The keyword that ends in the state, or -1.
+        std::vector<uint32_t> output_link;          // The nearest state on the failure chain with a keyword, or 0 (root).
+        std::vector<uint32_t> depth;                // The length of the keyword prefix the state stands for.
+        bool compiled = false;
+
+        static constexpr bool isWordByte(unsigned char c) noexcept {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        void compile(){
+            // Byte classes: class 0 is every byte that doesn't occur in any keyword.
+            class_count = 1;
+            for(uint8_t& c : byte_class) c = 0;
+            for(const Keyword& keyword : keywords){
+                for(unsigned char c : keyword.text){
+                    if(byte_class[c] == 0){
+                        if(class_count == 256) throw std::length_error("\nERROR: Too many distinct keyword bytes in 'Keyword_Highlighter'\n");
+                        byte_class[c] = static_cast<uint8_t>(class_count++);
+                    }
+                }
+            }
+
+            // The trie; 0 = no transition yet (the root is never a transition target).
+            transitions.assign(class_count, 0);
+            keyword_at.assign(1, -1);
+            depth.assign(1, 0);
+            for(std::size_t index = 0; index < keywords.size(); ++index){
+                uint32_t state = 0;
+                for(unsigned char c : keywords[index].text){
+                    uint32_t& next = transitions[std::size_t(state) * class_count + byte_class[c]];
+                    if(next == 0){
+                        next = static_cast<uint32_t>(keyword_at.size());
+                        keyword_at.push_back(-1);
+                        depth.push_back(depth[state] + 1);
+                        transitions.resize(transitions.size() + class_count, 0);
+                    }
+                    state = transitions[std::size_t(state) * class_count + byte_class[c]];
+                }
+                // A duplicate keyword keeps its first style.
+                if(keyword_at[state] < 0) keyword_at[state] = static_cast<int32_t>(index);
+            }
+
+            // Breadth first: failure links, output links and the missing transitions of the deterministic automaton.
+            const std::size_t state_count = keyword_at.size();
+            std::vector<uint32_t> failure(state_count, 0), queue;
+            output_link.assign(state_count, 0);
+            queue.reserve(state_count);
+            for(uint32_t c = 0; c < class_count; ++c){
+                if(transitions[c] != 0) queue.push_back(transitions[c]);
+            }
+            for(std::size_t head = 0; head < queue.size(); ++head){
+                const uint32_t state = queue[head];
+                const uint32_t fail = failure[state];
+                output_link[state] = keyword_at[fail] >= 0 ? fail : output_link[fail];
+                for(uint32_t c = 0; c < class_count; ++c){
+                    uint32_t& next = transitions[std::size_t(state) * class_count + c];
+                    const uint32_t fallback = transitions[std::size_t(fail) * class_count + c];
+                    if(next != 0){
+                        failure[next] = fallback;
+                        queue.push_back(next);
+                    } else {
+                        next = fallback;
+                    }
+                }
+            }
+            compiled = true;
+        }
+    public:
+        /// @brief Creates an empty highlighter.
+        /// @param whole_words If true, keywords only match as whole words. Default = true.
+        explicit Keyword_Highlighter(bool whole_words = true) : whole_words(whole_words){}
+
+        /// @brief Adds a keyword that is colored with `color` (e.g. `fg::PrimaryColors.Red.Pure_Red`).
+        void add(std::string keyword, const Color& color){ add(std::move(keyword), std::string(color.c_str())); }
+
+        /// @brief Adds a keyword that is preceded by an arbitrary escape sequence (e.g. a `Theme` role or a combination of `TextStyle`s).
+        void add(std::string keyword, std::string style){
+            if(keyword.empty()) return;
+            keywords.push_back(Keyword{std::move(keyword), std::move(style)});
+            compiled = false;
+        }
+
+        /// @brief Returns the number of keywords.
+        std::size_t size() const noexcept { return keywords.size(); }
+
+        /// @brief Compiles the automaton now, instead of on the first `colorize()` call after a change.
+        void prepare(){ if(!compiled) compile(); }
+
+        /// @brief Appends `text` to `out` with every keyword wrapped in its escape sequence and `Reset::All`.
+        ///        Call `prepare()` first when the highlighter is shared between threads.
+        void colorize(std::string_view text, std::string& out){
+            prepare();
+            static_cast<const Keyword_Highlighter&>(*this).colorize(text, out);
+        }
+
+        /// @brief Appends `text` to `out` with every keyword wrapped in its escape sequence and `Reset::All`.
+        /// @throws std::logic_error if the highlighter was changed after the last `prepare()`.
+        void colorize(std::string_view text, std::string& out) const {
+            if(!compiled) throw std::logic_error("\nERROR: 'Keyword_Highlighter' was changed without calling 'prepare()'\n");
+            const unsigned char* data = reinterpret_cast<const unsigned char*>(text.data());
+            const std::size_t size = text.size();
+            std::size_t copied = 0, position = 0;
+            uint32_t state = 0;
+            // The best match so far (leftmost, then longest) that is not written yet; 0 = none.
+            uint32_t pending = 0;
+            std::size_t pending_start = 0, pending_end = 0;
+            for(;;){
+                if(position == size && pending == 0) break;
+                if(position != size){
+                    state = transitions[std::size_t(state) * class_count + byte_class[data[position]]];
+                    const std::size_t end = ++position;
+                    // The output chain runs from the longest to the shortest keyword, so the first valid match starts leftmost.
+                    if(!whole_words || end == size || !isWordByte(data[end])){
+                        for(uint32_t match = keyword_at[state] >= 0 ? state : output_link[state]; match != 0; match = output_link[match]){
+                            const std::size_t start = end - depth[match];
+                            if(whole_words && start != 0 && isWordByte(data[start - 1])) continue;
+                            if(pending == 0 || start < pending_start || (start == pending_start && end > pending_end)){
+                                pending = match;
+                                pending_start = start;
+                                pending_end = end;
+                            }
+                            break;
+                        }
+                    }
+                    // A longer match starting at or before the pending one can only end later if the current state reaches back that far.
+                    if(pending == 0 || end - depth[state] <= pending_start) continue;
+                }
+                const Keyword& keyword = keywords[static_cast<std::size_t>(keyword_at[pending])];
+                out.append(text.data() + copied, pending_start - copied);
+                out += keyword.style;
+                out.append(text.data() + pending_start, pending_end - pending_start);
+                out += Reset::All;
+                copied = pending_end;
+                // Matches after the written one may have been passed over while it was pending: scan again from its end.
+                position = pending_end;
+                state = 0;
+                pending = 0;
+            }
+            out.append(text.data() + copied, size - copied);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,396 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher. 
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_INFO_HPP
+#define LEMONCODE_ANSICOLORS_INFO_HPP
+
+#include "AnsiColorsCore.hpp"
+#include <cstddef>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Bit flags for the color categories of `Defined_Color_Values`.
+    ///        A color code can be part of more than one category (e.g. 217 is both Red and Orange), so the flags can be combined with `|`.
+    struct Color_Category {
+        Color_Category() noexcept = delete;
+
+        inline static constexpr uint16_t None =         0;
+        inline static constexpr uint16_t Red =          1u << 0;
+        inline static constexpr uint16_t Orange =       1u << 1;
+        inline static constexpr uint16_t Yellow =       1u << 2;
+        inline static constexpr uint16_t Green =        1u << 3;
+        inline static constexpr uint16_t Cyan =         1u << 4;
+        inline static constexpr uint16_t Blue =         1u << 5;
+        inline static constexpr uint16_t Violet =       1u << 6;
+        inline static constexpr uint16_t Pink =         1u << 7;
+        inline static constexpr uint16_t Purple =       1u << 8;
+        inline static constexpr uint16_t Brown =        1u << 9;
+        inline static constexpr uint16_t GrayScale =    1u << 10;
+        inline static constexpr uint16_t Gray =         1u << 11;
+        inline static constexpr uint16_t White =        1u << 12;
+        inline static constexpr uint16_t Black =        1u << 13;
+        /// @brief The color codes of the `Shades` palette (232 – 255) are the GrayScale codes.
+        inline static constexpr uint16_t Shades =       GrayScale;
+        inline static constexpr uint16_t All =          0x3FFF;
+
+        ~Color_Category() noexcept = delete;
+    };
+
+    /// @brief Metadata of all ANSI 256 color codes, stored as a structure of arrays.
+    ///        Every array is indexed by the color code (0 – 255), so a query only touches the columns it needs.
+    struct Color_Table {
+        Color_Table() noexcept = delete;
+
+        /// @brief The red component of the color as rendered by xterm compatible terminals.
+        inline static constexpr uint8_t red[256] = {
+            0, 128, 0, 128, 0, 128, 0, 192, 128, 255, 0, 255, 0, 255, 0, 255,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+            95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+            95, 95, 95, 95, 95, 95, 95, 95, 135, 135, 135, 135, 135, 135, 135, 135,
+            135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+            135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 175, 175, 175, 175,
+            175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+            175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+            215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+            215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+            215, 215, 215, 215, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 8, 18, 28, 38, 48, 58, 68, 78,
+            88, 98, 108, 118, 128, 138, 148, 158, 168, 178, 188, 198, 208, 218, 228, 238
+        };
+        /// @brief The green component of the color as rendered by xterm compatible terminals.
+        inline static constexpr uint8_t green[256] = {
+            0, 0, 128, 128, 0, 0, 128, 192, 128, 0, 255, 255, 0, 0, 255, 255,
+            0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 135, 135, 135, 135,
+            135, 135, 175, 175, 175, 175, 175, 175, 215, 215, 215, 215, 215, 215, 255, 255,
+            255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95,
+            135, 135, 135, 135, 135, 135, 175, 175, 175, 175, 175, 175, 215, 215, 215, 215,
+            215, 215, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 95, 95,
+            95, 95, 95, 95, 135, 135, 135, 135, 135, 135, 175, 175, 175, 175, 175, 175,
+            215, 215, 215, 215, 215, 215, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0,
+            0, 0, 95, 95, 95, 95, 95, 95, 135, 135, 135, 135, 135, 135, 175, 175,
+            175, 175, 175, 175, 215, 215, 215, 215, 215, 215, 255, 255, 255, 255, 255, 255,
+            0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 135, 135, 135, 135,
+            135, 135, 175, 175, 175, 175, 175, 175, 215, 215, 215, 215, 215, 215, 255, 255,
+            255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95,
+            135, 135, 135, 135, 135, 135, 175, 175, 175, 175, 175, 175, 215, 215, 215, 215,
+            215, 215, 255, 255, 255, 255, 255, 255, 8, 18, 28, 38, 48, 58, 68, 78,
+            88, 98, 108, 118, 128, 138, 148, 158, 168, 178, 188, 198, 208, 218, 228, 238
+        };
+        /// @brief The blue component of the color as rendered by xterm compatible terminals.
+        inline static constexpr uint8_t blue[256] = {
+            0, 0, 0, 0, 128, 128, 128, 192, 128, 0, 0, 0, 255, 255, 255, 255,
+            0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175,
+            215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95,
+            135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255,
+            0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175,
+            215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95,
+            135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255,
+            0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175,
+            215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95,
+            135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255,
+            0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175,
+            215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95,
+            135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255,
+            0, 95, 135, 175, 215, 255, 0, 95, 135, 175, 215, 255, 0, 95, 135, 175,
+            215, 255, 0, 95, 135, 175, 215, 255, 8, 18, 28, 38, 48, 58, 68, 78,
+            88, 98, 108, 118, 128, 138, 148, 158, 168, 178, 188, 198, 208, 218, 228, 238
+        };
+
+        /// @brief The CIE L* (lightness, 0 – 100) value of the color (sRGB, D65 white point).
+        inline static constexpr float lab_L[256] = {
+            0.0000f, 25.5355f, 46.2274f, 51.8689f, 12.9720f, 29.7847f, 48.2541f, 77.7044f,
+            53.5850f, 53.2408f, 87.7347f, 97.1393f, 32.2970f, 60.3242f, 91.1132f, 100.0000f,
+            0.0000f, 7.4607f, 14.1088f, 20.4168f, 26.4612f, 32.2970f, 34.3629f, 36.0032f,
+            37.7211f, 40.0447f, 42.8962f, 46.1791f, 48.6692f, 49.6808f, 50.7754f, 52.3097f,
+            54.2717f, 56.6287f, 62.2178f, 62.9140f, 63.6775f, 64.7652f, 66.1843f, 67.9287f,
+            75.2003f, 75.7141f, 76.2813f, 77.0961f, 78.1706f, 79.5085f, 87.7347f, 88.1325f,
+            88.5734f, 89.2097f, 90.0539f, 91.1132f, 17.6162f, 21.0552f, 24.2655f, 28.1885f,
+            32.5650f, 37.2091f, 38.9288f, 40.3177f, 41.7924f, 43.8166f, 46.3413f, 49.2955f,
+            51.5654f, 52.4939f, 53.5023f, 54.9222f, 56.7477f, 58.9540f, 64.2350f, 64.8971f,
+            65.6241f, 66.6616f, 68.0178f, 69.6891f, 76.6980f, 77.1954f, 77.7449f, 78.5348f,
+            79.5774f, 80.8770f, 88.8984f, 89.2874f, 89.7188f, 90.3414f, 91.1680f, 92.2057f,
+            27.1653f, 29.3584f, 31.5812f, 34.4915f, 37.9450f, 41.7985f, 43.2660f, 44.4650f,
+            45.7507f, 47.5344f, 49.7873f, 52.4579f, 54.5321f, 55.3855f, 56.3155f, 57.6300f,
+            59.3281f, 61.3919f, 66.3749f, 67.0034f, 67.6945f, 68.6821f, 69.9759f, 71.5740f,
+            78.3159f, 78.7965f, 79.3278f, 80.0920f, 81.1015f, 82.3614f, 90.1685f, 90.5484f,
+            90.9696f, 91.5779f, 92.3858f, 93.4007f, 36.2088f, 37.7400f, 39.3534f, 41.5498f,
+            44.2640f, 47.4104f, 48.6370f, 49.6497f, 50.7452f, 52.2809f, 54.2444f, 56.6032f,
+            58.4560f, 59.2232f, 60.0623f, 61.2535f, 62.8007f, 64.6929f, 69.3090f, 69.8954f,
+            70.5412f, 71.4660f, 72.6804f, 74.1850f, 80.5799f, 81.0384f, 81.5456f, 82.2758f,
+            83.2417f, 84.4488f, 91.9678f, 92.3352f, 92.7427f, 93.3315f, 94.1140f, 95.0977f,
+            44.8743f, 46.0126f, 47.2367f, 48.9409f, 51.1019f, 53.6746f, 54.6953f, 55.5449f,
+            56.4708f, 57.7798f, 59.4713f, 61.5275f, 63.1597f, 63.8396f, 64.5858f, 65.6496f,
+            67.0388f, 68.7486f, 72.9642f, 73.5039f, 74.0992f, 74.9534f, 76.0782f, 77.4762f,
+            83.4685f, 83.9010f, 84.3797f, 85.0697f, 85.9836f, 87.1277f, 94.2983f, 94.6505f,
+            95.0412f, 95.6060f, 96.3573f, 97.3025f, 53.2408f, 54.1258f, 55.0888f, 56.4478f,
+            58.1998f, 60.3242f, 61.1778f, 61.8926f, 62.6760f, 63.7910f, 65.2440f, 67.0277f,
+            68.4562f, 69.0544f, 69.7130f, 70.6554f, 71.8921f, 73.4231f, 77.2361f, 77.7278f,
+            78.2712f, 79.0524f, 80.0838f, 81.3700f, 86.9306f, 87.3346f, 87.7823f, 88.4282f,
+            89.2849f, 90.3595f, 97.1393f, 97.4740f, 97.8456f, 98.3832f, 99.0987f, 100.0000f,
+            2.1934f, 5.4639f, 10.2682f, 15.1597f, 19.8655f, 24.4213f, 28.8519f, 33.1755f,
+            37.4059f, 41.5540f, 45.6287f, 49.6370f, 53.5850f, 57.4778f, 61.3196f, 65.1142f,
+            68.8650f, 72.5748f, 76.2461f, 79.8812f, 83.4822f, 87.0509f, 90.5889f, 94.0978f
+        };
+        /// @brief The CIE a* (green – red) value of the color (sRGB, D65 white point).
+        inline static constexpr float lab_a[256] = {
+            0.0000f, 48.0451f, -51.6985f, -12.9295f, 47.5023f, 58.9279f, -28.8463f, 0.0000f,
+            0.0000f, 80.0925f, -86.1827f, -21.5537f, 79.1875f, 98.2343f, -48.0875f, 0.0000f,
+            0.0000f, 38.3910f, 49.3662f, 59.7088f, 69.6192f, 79.1875f, -41.8415f, -23.3464f,
+            -8.2803f, 8.0504f, 24.2321f, 39.6116f, -53.7271f, -41.4682f, -29.9782f, -16.0877f,
+            -0.9845f, 14.4366f, -64.9833f, -56.2748f, -47.5337f, -36.2588f, -23.1800f, -9.0219f,
+            -75.7691f, -69.2381f, -62.4371f, -53.3178f, -42.2770f, -29.8039f, -86.1827f, -81.0793f,
+            -75.6499f, -68.1923f, -58.9039f, -48.0875f, 38.8847f, 47.6925f, 55.1093f, 63.4973f,
+            72.2784f, 81.1577f, -10.4643f, 0.0000f, 9.7169f, 21.3585f, 33.9106f, 46.6510f,
+            -31.1069f, -22.3661f, -13.7557f, -2.8603f, 9.5228f, 22.6697f, -48.2033f, -41.1710f,
+            -33.9633f, -24.4646f, -13.1893f, -0.7082f, -62.8807f, -57.2215f, -51.2709f, -43.2061f,
+            -33.3213f, -22.0101f, -75.9684f, -71.3547f, -66.4221f, -59.6085f, -51.0639f, -41.0388f,
+            49.9304f, 55.7250f, 61.2402f, 68.0434f, 75.6529f, 83.7069f, 9.1346f, 16.3110f,
+            23.3730f, 32.3009f, 42.4445f, 53.2240f, -13.4368f, -6.7681f, 0.0000f, 8.8257f,
+            19.1795f, 30.5082f, -33.3356f, -27.5272f, -21.4824f, -13.3847f, -3.5941f, 7.4479f,
+            -50.5853f, -45.6514f, -40.4218f, -33.2698f, -24.4098f, -14.1550f, -65.7702f, -61.5991f,
+            -57.1199f, -50.9008f, -43.0524f, -33.7793f, 60.3911f, 64.4953f, 68.6503f, 74.0704f,
+            80.4584f, 87.5204f, 27.3303f, 32.3459f, 37.4832f, 44.2496f, 52.2803f, 61.1783f,
+            5.0733f, 10.0700f, 15.2673f, 22.2258f, 30.6335f, 40.1112f, -16.2519f, -11.5993f,
+            -6.6872f, 0.0000f, 8.2385f, 17.7163f, -35.5139f, -31.3470f, -26.8929f, -20.7422f,
+            -13.0326f, -3.9933f, -52.7013f, -49.0367f, -45.0819f, -39.5582f, -32.5360f, -24.1695f,
+            70.4148f, 73.4883f, 76.7062f, 81.0514f, 86.3645f, 92.4463f, 43.5489f, 47.1953f,
+            51.0292f, 56.2254f, 62.5971f, 69.8974f, 22.8599f, 26.6342f, 30.6329f, 36.0982f,
+            42.8642f, 50.6913f, 1.4301f, 5.1195f, 9.0621f, 14.5048f, 21.3240f, 29.3157f,
+            -18.9494f, -15.4926f, -11.7687f, -6.5791f, 0.0000f, 7.8131f, -37.6682f, -34.5124f,
+            -31.0895f, -26.2802f, -20.1199f, -12.7160f, 80.0925f, 82.4922f, 85.0546f, 88.5910f,
+            93.0251f, 98.2343f, 58.0072f, 60.7691f, 63.7229f, 67.8052f, 72.9293f, 78.9505f,
+            39.3470f, 42.2564f, 45.3797f, 49.7148f, 55.1836f, 61.6435f, 18.7156f, 21.6519f,
+            24.8198f, 29.2427f, 34.8627f, 41.5547f, -1.9237f, 0.9256f, 4.0156f, 8.3564f,
+            13.9152f, 20.5942f, -21.5537f, -18.8669f, -15.9394f, -11.8032f, -6.4672f, 0.0000f,
+            0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
+            0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
+            0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f
+        };
+        /// @brief The CIE b* (blue – yellow) value of the color (sRGB, D65 white point).
+        inline static constexpr float lab_b[256] = {
+            0.0000f, 38.0573f, 49.8968f, 56.6746f, -64.7022f, -36.4871f, -8.4769f, 0.0000f,
+            0.0000f, 67.2032f, 83.1793f, 94.4780f, -107.8602f, -60.8249f, -14.1312f, 0.0000f,
+            0.0000f, -52.3441f, -67.2410f, -81.3284f, -94.8273f, -107.8602f, 40.3833f, -6.8607f,
+            -28.8381f, -49.0779f, -67.6659f, -84.8356f, 51.8548f, 12.8713f, -8.8095f, -29.6684f,
+            -49.3466f, -67.8258f, 62.7186f, 30.5528f, 9.9898f, -10.6552f, -30.6592f, -49.7922f,
+            73.1287f, 46.4158f, 27.3589f, 7.4148f, -12.4237f, -31.7438f, 83.1793f, 60.7843f,
+            43.3692f, 24.4088f, 5.0549f, -14.1312f, 27.2082f, -29.5303f, -50.1099f, -68.1894f,
+            -84.4951f, -99.5393f, 45.8688f, 0.0000f, -22.1848f, -42.8295f, -61.9152f, -79.6094f,
+            55.3623f, 17.1864f, -4.4596f, -25.4129f, -45.2638f, -63.9619f, 65.1701f, 33.4874f,
+            13.0130f, -7.6263f, -27.6801f, -46.9001f, 74.9519f, 48.5373f, 29.5709f, 9.6644f,
+            -10.1754f, -29.5248f, 84.5972f, 62.3925f, 45.0556f, 26.1405f, 6.8045f, -12.3846f,
+            40.1367f, -15.9030f, -37.9188f, -57.6118f, -75.4330f, -91.7918f, 50.9300f, 6.5128f,
+            -15.7667f, -36.7030f, -56.1845f, -74.3206f, 58.8984f, 21.5809f, 0.0000f, -21.0213f,
+            -41.0222f, -59.9207f, 67.7458f, 36.5829f, 16.2125f, -4.4107f, -24.5072f, -43.8100f,
+            76.9091f, 50.8185f, 31.9538f, 12.0921f, -7.7451f, -27.1219f, 86.1383f, 64.1416f,
+            46.8915f, 28.0279f, 8.7133f, -10.4771f, 50.5738f, -2.4383f, -25.1287f, -45.8630f,
+            -64.8486f, -82.3566f, 57.0292f, 14.5363f, -7.7434f, -28.9309f, -48.8060f, -67.4119f,
+            63.4951f, 27.3480f, 5.8948f, -15.1760f, -35.3367f, -54.4651f, 71.2380f, 40.7968f,
+            20.5850f, 0.0000f, -20.1396f, -39.5407f, 79.6274f, 53.9923f, 35.2760f, 15.4841f,
+            -4.3424f, -23.7508f, 88.3097f, 66.6080f, 49.4836f, 30.6961f, 11.4152f, -7.7737f,
+            59.0829f, 10.5290f, -12.3486f, -33.6818f, -53.4753f, -71.8790f, 63.7269f, 23.4949f,
+            1.3459f, -20.0002f, -40.2046f, -59.2414f, 68.8974f, 34.1856f, 12.9412f, -8.1342f,
+            -28.4339f, -47.7889f, 75.5292f, 45.9964f, 26.0054f, 5.4923f, -14.6771f, -34.1779f,
+            83.0621f, 58.0100f, 39.4933f, 19.8016f, 0.0000f, -19.4378f, 91.1024f, 69.7829f,
+            52.8255f, 34.1421f, 14.9106f, -4.2707f, 67.2032f, 22.9110f, 0.1681f, -21.4507f,
+            -41.7660f, -60.8249f, 70.7252f, 32.9401f, 11.0592f, -10.3331f, -30.7731f, -50.1652f,
+            74.8585f, 41.7783f, 20.8326f, -0.1847f, -20.5799f, -40.1322f, 80.4677f, 52.0010f,
+            32.2977f, 11.8997f, -8.2740f, -27.8613f, 87.1320f, 62.7789f, 44.5147f, 24.9586f,
+            5.2026f, -14.2549f, 94.4780f, 73.6233f, 56.8756f, 38.3269f, 19.1639f, 0.0000f,
+            0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
+            0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
+            0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f
+        };
+
+        /// @brief The relative luminance (0.0 – 1.0) of the color, as defined by WCAG 2.
+        inline static constexpr float luminance[256] = {
+            0.000000f, 0.045892f, 0.154383f, 0.200275f, 0.015585f, 0.061477f, 0.169969f, 0.527115f,
+            0.215861f, 0.212600f, 0.715200f, 0.927800f, 0.072200f, 0.284800f, 0.787400f, 1.000000f,
+            0.000000f, 0.008262f, 0.017493f, 0.030951f, 0.049063f, 0.072200f, 0.081844f, 0.090106f,
+            0.099337f, 0.112796f, 0.130907f, 0.154044f, 0.173279f, 0.181542f, 0.190772f, 0.204231f,
+            0.222342f, 0.245479f, 0.306599f, 0.314862f, 0.324092f, 0.337551f, 0.355662f, 0.378799f,
+            0.486009f, 0.494271f, 0.503501f, 0.516960f, 0.535072f, 0.558209f, 0.715200f, 0.723462f,
+            0.732693f, 0.746151f, 0.764263f, 0.787400f, 0.024329f, 0.032591f, 0.041822f, 0.055280f,
+            0.073392f, 0.096529f, 0.106173f, 0.114435f, 0.123666f, 0.137125f, 0.155236f, 0.178373f,
+            0.197608f, 0.205871f, 0.215101f, 0.228560f, 0.246671f, 0.269808f, 0.330928f, 0.339191f,
+            0.348421f, 0.361880f, 0.379991f, 0.403128f, 0.510338f, 0.518600f, 0.527830f, 0.541289f,
+            0.559401f, 0.582538f, 0.739529f, 0.747791f, 0.757022f, 0.770480f, 0.788592f, 0.811729f,
+            0.051509f, 0.059771f, 0.069002f, 0.082460f, 0.100572f, 0.123709f, 0.133353f, 0.141615f,
+            0.150846f, 0.164305f, 0.182416f, 0.205553f, 0.224788f, 0.233051f, 0.242281f, 0.255740f,
+            0.273851f, 0.296988f, 0.358108f, 0.366371f, 0.375601f, 0.389060f, 0.407171f, 0.430308f,
+            0.537518f, 0.545780f, 0.555010f, 0.568469f, 0.586581f, 0.609718f, 0.766709f, 0.774971f,
+            0.784202f, 0.797660f, 0.815772f, 0.838909f, 0.091140f, 0.099402f, 0.108632f, 0.122091f,
+            0.140203f, 0.163340f, 0.172984f, 0.181246f, 0.190476f, 0.203935f, 0.222047f, 0.245184f,
+            0.264419f, 0.272681f, 0.281912f, 0.295371f, 0.313482f, 0.336619f, 0.397739f, 0.406001f,
+            0.415232f, 0.428690f, 0.446802f, 0.469939f, 0.577148f, 0.585411f, 0.594641f, 0.608100f,
+            0.626211f, 0.649348f, 0.806340f, 0.814602f, 0.823832f, 0.837291f, 0.855403f, 0.878540f,
+            0.144471f, 0.152733f, 0.161963f, 0.175422f, 0.193534f, 0.216671f, 0.226315f, 0.234577f,
+            0.243808f, 0.257266f, 0.275378f, 0.298515f, 0.317750f, 0.326012f, 0.335243f, 0.348702f,
+            0.366813f, 0.389950f, 0.451070f, 0.459332f, 0.468563f, 0.482022f, 0.500133f, 0.523270f,
+            0.630480f, 0.638742f, 0.647972f, 0.661431f, 0.679542f, 0.702680f, 0.859671f, 0.867933f,
+            0.877163f, 0.890622f, 0.908734f, 0.931871f, 0.212600f, 0.220862f, 0.230093f, 0.243551f,
+            0.261663f, 0.284800f, 0.294444f, 0.302706f, 0.311937f, 0.325396f, 0.343507f, 0.366644f,
+            0.385879f, 0.394142f, 0.403372f, 0.416831f, 0.434942f, 0.458079f, 0.519199f, 0.527462f,
+            0.536692f, 0.550151f, 0.568262f, 0.591399f, 0.698609f, 0.706871f, 0.716101f, 0.729560f,
+            0.747672f, 0.770809f, 0.927800f, 0.936062f, 0.945293f, 0.958751f, 0.976863f, 1.000000f,
+            0.002428f, 0.006049f, 0.011612f, 0.019382f, 0.029557f, 0.042311f, 0.057805f, 0.076185f,
+            0.097587f, 0.122139f, 0.149960f, 0.181164f, 0.215861f, 0.254152f, 0.296138f, 0.341914f,
+            0.391572f, 0.445201f, 0.502886f, 0.564712f, 0.630757f, 0.701102f, 0.775822f, 0.854993f
+        };
+
+        /// @brief The `Color_Category` flags of the color.
+        inline static constexpr uint16_t category[256] = {
+            0x2000, 0x0001, 0x0008, 0x0004, 0x0020, 0x0100, 0x0010, 0x1000, 0x0800, 0x0001, 0x0008, 0x0004, 0x0020, 0x0080, 0x0010, 0x1000,
+            0x2000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0008, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0008, 0x0008, 0x0010, 0x0010,
+            0x0020, 0x0020, 0x0008, 0x0008, 0x0010, 0x0010, 0x0020, 0x0020, 0x0008, 0x0008, 0x0008, 0x0010, 0x0010, 0x0020, 0x0008, 0x0008,
+            0x0008, 0x0008, 0x0010, 0x0010, 0x0001, 0x0100, 0x0040, 0x0040, 0x0040, 0x0040, 0x0008, 0x0800, 0x0020, 0x0020, 0x0020, 0x0020,
+            0x0008, 0x0008, 0x0010, 0x0020, 0x0020, 0x0020, 0x0008, 0x0008, 0x0008, 0x0010, 0x0020, 0x0020, 0x0008, 0x0008, 0x0008, 0x0010,
+            0x0010, 0x0020, 0x0008, 0x0008, 0x0008, 0x0008, 0x0010, 0x0010, 0x0001, 0x0080, 0x0100, 0x0100, 0x0040, 0x0040, 0x0200, 0x0200,
+            0x0100, 0x0040, 0x0040, 0x0040, 0x0004, 0x0008, 0x0800, 0x0020, 0x0020, 0x0020, 0x0008, 0x0008, 0x0008, 0x0010, 0x0020, 0x0020,
+            0x0008, 0x0008, 0x0008, 0x0010, 0x0010, 0x0010, 0x0008, 0x0008, 0x0008, 0x0008, 0x0010, 0x0010, 0x0001, 0x0080, 0x0100, 0x0100,
+            0x0100, 0x0100, 0x0002, 0x0200, 0x0080, 0x0100, 0x0100, 0x0040, 0x0200, 0x0200, 0x0200, 0x0100, 0x0040, 0x0040, 0x0004, 0x0004,
+            0x0004, 0x0800, 0x0020, 0x0020, 0x0008, 0x0008, 0x0008, 0x0008, 0x0010, 0x0020, 0x0008, 0x0008, 0x0008, 0x0008, 0x0010, 0x0010,
+            0x0001, 0x0080, 0x0080, 0x0080, 0x0100, 0x0100, 0x0002, 0x0001, 0x0080, 0x0080, 0x0100, 0x0100, 0x0002, 0x0200, 0x0080, 0x0080,
+            0x0100, 0x0040, 0x0004, 0x0200, 0x0200, 0x0200, 0x0040, 0x0040, 0x0004, 0x0004, 0x0004, 0x0004, 0x0800, 0x0020, 0x0004, 0x0004,
+            0x0004, 0x0008, 0x0008, 0x0010, 0x0001, 0x0080, 0x0080, 0x0080, 0x0080, 0x0100, 0x0002, 0x0001, 0x0080, 0x0080, 0x0080, 0x0100,
+            0x0002, 0x0002, 0x0001, 0x0080, 0x0080, 0x0100, 0x0002, 0x0002, 0x0002, 0x0003, 0x0080, 0x0100, 0x0004, 0x0004, 0x0004, 0x0200,
+            0x0080, 0x0100, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x1000, 0x2400, 0x2400, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
+            0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x1400
+        };
+
+        /// @brief The member name of the color in its (first) color palette, e.g. `Pure_Red` for 196.
+        inline static constexpr const char* palette_name[256] = {
+            "std_Black", "std_Red", "std_Green", "std_Yellow", "std_Blue", "std_Purple",
+            "std_Cyan", "std_White", "std_Gray", "std_Bright_Red", "std_Bright_Green", "std_Bright_Yellow",
+            "std_Bright_Blue", "std_Pink", "std_Bright_Cyan", "Snowflake_White", "Extended_Black", "Dark_Navy_Blue",
+            "Deep_Navy_Blue", "Navy_Blue", "Dark_Blue", "Deep_Blue", "Dark_Green", "Dark_Cyan",
+            "Deep_Cyan", "Deep_Sky_Blue", "Science_Blue", "Pure_Blue", "Medium_Green", "Deep_Sea_Green",
+            "Dark_Turquoise", "Medium_Turquoise", "Ocean_Blue", "Vivid_Blue", "Spring_Green", "Jade_Green",
+            "Rich_Cyan", "Tiffany_Cyan", "Cerulean_Blue", "Azure_Blue", "Lime_Green", "Light_Spring_Green",
+            "Caribbean_Green", "Lagoon_Cyan", "Vibrant_Turquoise", "Vivid_Sky_Blue", "Pure_Green", "Vibrant_Spring_Green",
+            "Soft_Spring_Green", "Brilliant_Spring_Green", "Pure_Cyan", "Aqua_Cyan", "Dark_Blood_Red", "Imperial_Purple",
+            "Deep_Orchid_Violet", "Amethyst_Violet", "Orchid_Violet", "Blue_Violet", "Dark_Olive_Green", "Granite_Gray",
+            "Misty_Slate_Blue", "Comet_Blue", "Slate_Blue", "Bright_Blue", "Olive_Green", "Glade_Green",
+            "Juniper_Cyan", "Lochmara_Blue", "Steel_Blue", "Light_Slate_Blue", "Kelly_Green", "Dark_Sea_Green",
+            "Cadet_Green", "Harbor_Cyan", "Aegean_Blue", "Iceberg_Blue", "Strong_Green", "Moderate_Lime_Green",
+            "Sea_Green", "Myrtle_Cyan", "Tidewater_Cyan", "Dusky_Sky_Blue", "Chartreuse", "Light_Lime_Green",
+            "Light_Sea_Green", "Luminous_Spring_Green", "Reef_Cyan", "Frost_Cyan", "Deep_Red", "Dark_Pink",
+            "Velvet_Plum_Purple", "Mystic_Amethyst_Purple", "Strong_Violet", "Electric_Violet", "Russet_Brown", "Brick_Rose_Brown",
+            "Smokey_Orchid_Purple", "Smokey_Amethyst_Violet", "Dusty_Lavender_Violet", "Munstead_Violet", "Mustard_Yellow", "Clay_Creek_Green",
+            "Smoke_Gray", "Dusky_Cobalt_Blue", "Soft_Indigo_Blue", "Misty_Cornflower_Blue", "Apple_Green", "Asparagus_Green",
+            "Moss_Green", "Pewter_Cyan", "Horizon_Blue", "Soft_Sky_Blue", "Pistachio_Green", "Mantis_Green",
+            "Pale_Green", "Sage_Cyan", "Bermuda_Cyan", "Morning_Mist_Cyan", "Bright_Chartreuse", "Light_Green",
+            "Soft_Green", "Mint_Green", "Aquamarine_Cyan", "Opal_Cyan", "Dark_Red", "Raspberry_Rose_Pink",
+            "Velvet_Magenta_Purple", "Heliotrope_Purple", "Orchid_Purple", "Fuchsia_Purple", "Dark_Orange", "Chestnut_Brown",
+            "Peony_Pink", "Lilac_Purple", "Heather_Purple", "Light_Violet", "Dark_Goldenrod_Brown", "Desert_Sand_Brown",
+            "Dusty_Taupe_Brown", "Mauve_Purple", "Hazy_Lilac_Violet", "Lavender_Violet", "Light_Gold", "Dark_Khaki",
+            "Light_Khaki", "Fog_Gray", "Light_Pearl_Blue", "Light_Steel_Blue", "Green_Yellow", "June_Bud_Green",
+            "Pastel_Lime", "Grayish_Lime_Green", "Shallows_Cyan", "Pastel_Blue", "Spring_Bud_Green", "Pastel_Sea_Green",
+            "Seafoam_Green", "Caladon_Green", "Algae_Cyan", "Glacier_Cyan", "Bright_Red", "Vivid_Pink",
+            "Deep_Fuchsia_Pink", "Fuchsia_Pink", "Electric_Fuchsia_Purple", "Orchid_Magenta_Purple", "Strong_Orange", "Rust_Red",
+            "Rosebud_Pink", "Dreamy_Raspberry_Pink", "Light_Magenta_Purple", "Haze_Purple", "Burnt_Orange", "Copperfield_Brown",
+            "Blush_Rose_Pink", "Rose_Quartz_Pink", "Pastel_Orchid_Purple", "Misty_Lavender_Violet", "Deep_Yellow", "Sandstone_Brown",
+            "Light_Sandstone_Brown", "Pale_Chestnut_Brown", "Frosted_Lavender_Violet", "Pearl_Violet", "Strong_Yellow", "Mellow_Yellow",
+            "Muted_Yellow", "Soft_Yellow", "Frosted_Gray", "Pale_Blue", "Neon_Yellow", "Bright_Lemon",
+            "Lemon_Lime", "Tea_Green", "Pastel_Green", "Ebb_Tide_Cyan", "Pure_Red", "Vivid_Raspberry_Pink",
+            "Neon_Rose_Pink", "Dragonfruit_Pink", "Electric_Magenta_Pink", "Radiant_Amethyst_Purple", "Pure_Orange", "Blush_Red",
+            "Watermelon_Candy_Pink", "Cherry_Blossom_Pink", "Silk_Rose_Pink", "Pastel_Fuchsia_Purple", "Amber", "Coral_Orange",
+            "Rosy_Red", "Tickle_Me_Pink", "Princess_Perfume_Pink", "Cotton_Candy_Purple", "Golden_Orange", "Sandy_Orange",
+            "Light_Salmon_Orange", "Pastel_Red", "Rosewater_Pink", "Pastel_Plum_Purple", "Amber", "Honey_Yellow",
+            "Marigold_Yellow", "Pastel_Moccasin_Brown", "Powder_Pink", "Pale_Lilac_Purple", "Pure_Yellow", "Golden_Yellow",
+            "Pastel_Yellow", "Light_Yellow", "Pale_Yellow", "Pure_White", "Vampire_Black", "Nightshade_Black",
+            "Soot_Gray", "Graphite_Gray", "Charcoal_Gray", "Dusty_Charcoal_Gray", "Slate_Gray", "Gravel_Gray",
+            "Shadow_Gray", "Nickel_Gray", "Mercury_Gray", "Dove_Gray", "Flint_Gray", "Driftwood_Gray",
+            "Stone_Gray", "Silver_Gray", "Concrete_Gray", "Aluminum_Gray", "Silver_Foil_Gray", "Chalk_Gray",
+            "Marble_Gray", "Porcelain_Gray", "Snow_Gray", "Pearl_White"
+        };
+        /// @brief The member name of the color in its (first) sorted color range, e.g. `Red6` for 196.
+        inline static constexpr const char* range_name[256] = {
+            "Black3", "Red4", "Green7", "Yellow2", "Blue5", "Purple3", "Cyan3", "White1",
+            "Gray12", "Red7", "Green13", "Yellow16", "Blue15", "Pink3", "Cyan14", "White3",
+            "Black1", "Blue1", "Blue2", "Blue3", "Blue4", "Blue6", "Green1", "Cyan1",
+            "Cyan2", "Blue7", "Blue8", "Blue9", "Green3", "Green4", "Cyan4", "Cyan5",
+            "Blue14", "Blue16", "Green8", "Green9", "Cyan7", "Cyan8", "Blue21", "Blue23",
+            "Green14", "Green17", "Green19", "Cyan10", "Cyan12", "Blue28", "Green23", "Green26",
+            "Green29", "Green31", "Cyan17", "Cyan19", "Red1", "Purple1", "Violet1", "Violet2",
+            "Violet3", "Violet4", "Green2", "Gray8", "Blue10", "Blue11", "Blue12", "Blue13",
+            "Green5", "Green6", "Cyan6", "Blue17", "Blue18", "Blue19", "Green11", "Green12",
+            "Green16", "Cyan9", "Blue25", "Blue26", "Green21", "Green22", "Green25", "Cyan13",
+            "Cyan15", "Blue32", "Green34", "Green36", "Green38", "Green39", "Cyan22", "Cyan23",
+            "Red2", "Pink1", "Purple2", "Purple4", "Violet5", "Violet6", "Brown1", "Brown2",
+            "Purple12", "Violet7", "Violet8", "Violet9", "Yellow1", "Green10", "Gray14", "Blue20",
+            "Blue22", "Blue24", "Green15", "Green18", "Green20", "Cyan11", "Blue27", "Blue29",
+            "Green24", "Green27", "Green30", "Cyan16", "Cyan18", "Cyan20", "Green37", "Green40",
+            "Green42", "Green43", "Cyan24", "Cyan25", "Red3", "Pink2", "Purple5", "Purple6",
+            "Purple7", "Purple8", "Orange1", "Brown3", "Pink11", "Purple13", "Purple14", "Violet10",
+            "Brown4", "Brown5", "Brown6", "Purple18", "Violet11", "Violet12", "Yellow3", "Yellow4",
+            "Yellow6", "Gray19", "Blue30", "Blue31", "Green28", "Green32", "Green33", "Green35",
+            "Cyan21", "Blue33", "Green41", "Green44", "Green45", "Green46", "Cyan26", "Cyan27",
+            "Red5", "Pink4", "Pink5", "Pink6", "Purple9", "Purple10", "Orange2", "Red8",
+            "Pink12", "Pink13", "Purple15", "Purple16", "Orange4", "Brown7", "Pink17", "Pink18",
+            "Purple19", "Violet13", "Yellow5", "Brown8", "Brown9", "Brown10", "Violet14", "Violet15",
+            "Yellow7", "Yellow8", "Yellow10", "Yellow11", "Gray24", "Blue34", "Yellow14", "Yellow15",
+            "Yellow18", "Green47", "Green48", "Cyan28", "Red6", "Pink7", "Pink8", "Pink9",
+            "Pink10", "Purple11", "Orange3", "Red9", "Pink14", "Pink15", "Pink16", "Purple17",
+            "Orange5", "Orange6", "Red10", "Pink19", "Pink20", "Purple20", "Orange7", "Orange8",
+            "Orange9", "Red11", "Pink21", "Purple21", "Yellow9", "Yellow12", "Yellow13", "Brown11",
+            "Pink22", "Purple22", "Yellow17", "Yellow19", "Yellow20", "Yellow21", "Yellow22", "White4",
+            "Black2", "Black4", "Gray1", "Gray2", "Gray3", "Gray4", "Gray5", "Gray6",
+            "Gray7", "Gray9", "Gray10", "Gray11", "Gray13", "Gray15", "Gray16", "Gray17",
+            "Gray18", "Gray20", "Gray21", "Gray22", "Gray23", "Gray25", "Gray26", "White2"
+        };
+
+        /// @brief The length in bytes of the foreground and background escape sequences (both have the same length).
+        inline static constexpr uint8_t escape_length[256] = {
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11
+        };
+
+        ~Color_Table() noexcept = delete;
+    };
+
+    /// @brief Collects all color codes that are part of (one of) the given categories and whose luminance lies within the given range.
+    /// @param out A buffer of at least 256 entries that receives the matching color codes in ascending order.
+    /// @param category The `Color_Category` flags to match (any of).
+    /// @param min_luminance The minimum relative luminance (inclusive). Default = 0.0.
+    /// @param max_luminance The maximum relative luminance (inclusive). Default = 1.0.
+    /// @return The number of color codes written to `out`.
+    inline std::size_t select_codes(uint8_t* out, uint16_t category, float min_luminance = 0.0f, float max_luminance = 1.0f) noexcept {
+        std::size_t count = 0;
+        // Branch free: every code is written, but only the matching ones advance the output position.
+        for(int code = 0; code < 256; ++code){
+            const bool match = ((Color_Table::category[code] & category) != 0)
+                             & (Color_Table::luminance[code] >= min_luminance)
+                             & (Color_Table::luminance[code] <= max_luminance);
+            out[count] = static_cast<uint8_t>(code);
+            count += match;
+        }
+        return count;
+    }
+}
+
+#endif
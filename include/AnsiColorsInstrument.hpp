@@ -0,0 +1,249 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_INSTRUMENT_HPP
+#define LEMONCODE_ANSICOLORS_INSTRUMENT_HPP
+
+// Optional instrumentation of the emitted escape sequences: how many there are, how many bytes they take compared to the text,
+// how many are resets, and how many don't change anything (redundant).
+//
+// The counting is compiled out unless `LEMONCODE_ANSICOLORS_INSTRUMENTATION` is defined as 1 (before including any AnsiColors
+// header). Compiled out, the API below still exists, but it doesn't attach to streams and all counters stay 0.
+
+#include "AnsiColorsCore.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <streambuf>
+#include <string_view>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The counters of an instrumented stream or sink.
+    struct Emission_Stats {
+        /// @brief The number of escape sequences (SGR, cursor and other CSI sequences, and other ESC sequences like "\033(B").
+        uint64_t escape_sequences = 0;
+        /// @brief The bytes of all escape sequences, including their ESC.
+        uint64_t escape_bytes = 0;
+        /// @brief The bytes of everything else: the text itself.
+        uint64_t payload_bytes = 0;
+        /// @brief The SGR sequences that reset something (`Reset::All`, `Reset::FgColor`, `Reset::Bold`, ...).
+        uint64_t resets = 0;
+        /// @brief The SGR sequences that didn't change the color or style state (e.g. a reset when nothing is set, or the same color twice).
+        uint64_t redundant_sequences = 0;
+    };
+
+    /// @brief Counts the escape sequences in emitted output. Feed it everything that goes to one sink, in order
+    ///        (e.g. the strings rendered by `Screen::present()` or a `Keyword_Highlighter`); sequences may be split over calls.
+    ///
+    /// To detect redundant sequences it tracks the SGR state of the sink: the foreground and background color and the text styles.
+    class Emission_Counter {
+        enum class Parse : uint8_t { Text, Escape, Csi };
+
+        Emission_Stats stats;
+        Parse parse = Parse::Text;
+        uint32_t sequence_size = 0;
+
+        // The parameters of the current CSI sequence.
+        uint32_t params[16] = {};
+        uint32_t param_count = 0;
+
+        // The SGR state: a color is -1 (default), a color code (0 - 255) or 0x1000000 | RGB (true color).
+        int32_t fg = -1, bg = -1;
+        uint16_t styles = 0;
+
+        static constexpr uint16_t styleBits(uint32_t off) noexcept {
+            // The SGR parameters that switch styles off: 22 (bold and faint), 23 (italic), ..., 29 (strikethrough).
+            return off == 22 ? uint16_t((1u << 1) | (1u << 2)) : uint16_t(1u << (off - 20));
+        }
+
+        int32_t extendedColor(uint32_t& index) const noexcept {
+            // 38;5;n / 48;5;n (256 colors) or 38;2;r;g;b / 48;2;r;g;b (true color).
+            if(index + 2 < param_count && params[index + 1] == 5){
+                index += 2;
+                return static_cast<int32_t>(params[index] & 0xFF);
+            }
+            if(index + 4 < param_count && params[index + 1] == 2){
+                const int32_t rgb = static_cast<int32_t>(((params[index + 2] & 0xFF) << 16) | ((params[index + 3] & 0xFF) << 8) | (params[index + 4] & 0xFF));
+                index += 4;
+                return 0x1000000 | rgb;
+            }
+            index = param_count;
+            return -1;
+        }
+
+        void endSgr() noexcept {
+            if(param_count == 0) params[param_count++] = 0;
+            const int32_t old_fg = fg, old_bg = bg;
+            const uint16_t old_styles = styles;
+            bool reset = false;
+            for(uint32_t index = 0; index < param_count; ++index){
+                const uint32_t param = params[index];
+                if(param == 0){
+                    fg = bg = -1;
+                    styles = 0;
+                    reset = true;
+                } else if(param <= 9){
+                    styles = static_cast<uint16_t>(styles | (1u << param));
+                } else if(param >= 22 && param <= 29){
+                    styles = static_cast<uint16_t>(styles & ~styleBits(param));
+                    reset = true;
+                } else if(param >= 30 && param <= 37){
+                    fg = static_cast<int32_t>(param - 30);
+                } else if(param >= 90 && param <= 97){
+                    fg = static_cast<int32_t>(param - 90 + 8);
+                } else if(param >= 40 && param <= 47){
+                    bg = static_cast<int32_t>(param - 40);
+                } else if(param >= 100 && param <= 107){
+                    bg = static_cast<int32_t>(param - 100 + 8);
+                } else if(param == 38){
+                    fg = extendedColor(index);
+                } else if(param == 48){
+                    bg = extendedColor(index);
+                } else if(param == 39 || param == 49){
+                    (param == 39 ? fg : bg) = -1;
+                    reset = true;
+                }
+            }
+            if(reset) ++stats.resets;
+            if(fg == old_fg && bg == old_bg && styles == old_styles) ++stats.redundant_sequences;
+        }
+
+        void endSequence() noexcept {
+            ++stats.escape_sequences;
+            stats.escape_bytes += sequence_size;
+            parse = Parse::Text;
+        }
+    public:
+        /// @brief Counts the next part of the output.
+        void count(std::string_view output) noexcept {
+#if LEMONCODE_ANSICOLORS_INSTRUMENTATION
+            for(char c : output){
+                const unsigned char byte = static_cast<unsigned char>(c);
+                switch(parse){
+                    case Parse::Text:
+                        if(byte == 0x1B){
+                            parse = Parse::Escape;
+                            sequence_size = 1;
+                        } else {
+                            ++stats.payload_bytes;
+                        }
+                        break;
+                    case Parse::Escape:
+                        ++sequence_size;
+                        if(byte == '['){
+                            parse = Parse::Csi;
+                            param_count = 0;
+                            params[0] = 0;
+                        } else if(byte < 0x20 || byte > 0x2F){
+                            // Intermediate bytes (e.g. the '(' of "\033(B") are part of the sequence; any other byte ends it.
+                            endSequence();
+                        }
+                        break;
+                    case Parse::Csi:
+                        ++sequence_size;
+                        if(byte >= '0' && byte <= '9'){
+                            if(param_count == 0) param_count = 1;
+                            uint32_t& param = params[param_count - 1];
+                            param = param < 100000 ? param * 10 + (byte - '0') : param;
+                        } else if(byte == ';' || byte == ':'){
+                            if(param_count == 0) param_count = 1;
+                            if(param_count < 16) params[param_count++] = 0;
+                        } else if(byte >= 0x40 && byte <= 0x7E){
+                            if(byte == 'm') endSgr();
+                            endSequence();
+                        } else if(byte < 0x20 || byte > 0x3F){
+                            // Not a valid CSI byte: the sequence ends here.
+                            endSequence();
+                        }
+                        break;
+                }
+            }
+#else
+            (void)output;
+#endif
+        }
+
+        /// @brief Returns the counters so far.
+        Emission_Stats snapshot() const noexcept { return stats; }
+
+        /// @brief Sets all counters to 0 (the tracked SGR state is kept).
+        void clear() noexcept { stats = Emission_Stats{}; }
+    };
+
+    /// @brief Instruments an output stream (e.g. `std::cout`) for its lifetime: everything written to it is counted by an
+    ///        `Emission_Counter` before it's passed on to the original stream buffer.
+    ///
+    /// The optional callback receives a snapshot every time the stream is flushed, and a final one when the instrumentation
+    /// is removed (on destruction).
+    class Instrumented_Stream : private std::streambuf {
+        std::ostream& stream;
+        std::streambuf* target;
+        Emission_Counter counter;
+        std::function<void(const Emission_Stats&)> callback;
+
+        int_type overflow(int_type c) override {
+            if(traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+            const char byte = traits_type::to_char_type(c);
+            counter.count(std::string_view(&byte, 1));
+            return target->sputc(byte);
+        }
+
+        std::streamsize xsputn(const char* data, std::streamsize size) override {
+            counter.count(std::string_view(data, static_cast<std::size_t>(size)));
+            return target->sputn(data, size);
+        }
+
+        int sync() override {
+            const int result = target->pubsync();
+            if(callback) callback(counter.snapshot());
+            return result;
+        }
+    public:
+        Instrumented_Stream() = delete;
+        Instrumented_Stream(const Instrumented_Stream&) = delete;
+        Instrumented_Stream&operator=(const Instrumented_Stream&) = delete;
+
+        /// @brief Starts counting everything that is written to `stream`.
+        /// @param stream The stream to instrument; it must outlive this object.
+        /// @param callback Optional: called with a snapshot on every flush and on destruction.
+        explicit Instrumented_Stream(std::ostream& stream, std::function<void(const Emission_Stats&)> callback = {})
+            : stream(stream), target(stream.rdbuf()), callback(std::move(callback)){
+#if LEMONCODE_ANSICOLORS_INSTRUMENTATION
+            stream.rdbuf(this);
+#endif
+        }
+
+        /// @brief Returns the counters so far.
+        Emission_Stats snapshot() const noexcept { return counter.snapshot(); }
+
+        /// @brief Restores the original stream buffer.
+        ~Instrumented_Stream() noexcept {
+#if LEMONCODE_ANSICOLORS_INSTRUMENTATION
+            stream.rdbuf(target);
+            if(callback) callback(counter.snapshot());
+#endif
+        }
+    };
+
+    /// @brief Helper namespace for the process wide counters of the instrumentation.
+    namespace __LMN_instrumentation_ {
+        inline std::atomic<uint64_t> formatter_calls {0};
+    }
+
+    /// @brief Returns how many times a `std::formatter` of this API has formatted a color or palette, process wide
+    ///        (a formatter doesn't know which stream or sink its output goes to).
+    inline uint64_t formatter_invocations() noexcept {
+        return __LMN_instrumentation_::formatter_calls.load(std::memory_order_relaxed);
+    }
+}
+
+#endif
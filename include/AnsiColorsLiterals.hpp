@@ -0,0 +1,67 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_LITERALS_HPP
+#define LEMONCODE_ANSICOLORS_LITERALS_HPP
+
+// Hex color literals (C++20): `"#ff8800"_fg` and `"#1e1e1e"_bg`.
+// The literal operators are consteval: the hex digits are parsed and mapped with `rgb_to_ansi256()` by the compiler, so a
+// literal is a `Color` constant (two bytes) without any runtime cost, and a malformed literal doesn't compile.
+
+#include "AnsiColorsCore.hpp"
+
+#if LEMONCODE_ANSICOLORS_CPP20_OR_NEWER
+    #include <cstddef>
+
+    /// @brief Helper namespace for parsing hex color literals.
+    /// @warning Users of this header should not modify the declarations or definitions in this namespace.
+    namespace __LMN_literals_helper_ {
+        consteval uint8_t hexDigit(char c){
+            if(c >= '0' && c <= '9') return static_cast<uint8_t>(c - '0');
+            if(c >= 'a' && c <= 'f') return static_cast<uint8_t>(c - 'a' + 10);
+            if(c >= 'A' && c <= 'F') return static_cast<uint8_t>(c - 'A' + 10);
+            // Not a constant expression: reported by the compiler at the literal.
+            throw std::invalid_argument("\nERROR: Invalid hex color literal:\n\n\t-Only the digits 0 - 9, a - f and A - F are allowed after the '#'.\n");
+        }
+
+        /// @brief Returns the ANSI 256 color code of a `#rrggbb` literal.
+        consteval uint8_t hexColorCode(const char* literal, std::size_t size){
+            if(size != 7 || literal[0] != '#'){
+                throw std::invalid_argument("\nERROR: Invalid hex color literal:\n\n\t-A hex color literal has the form \"#rrggbb\".\n");
+            }
+            uint8_t rgb[3] {};
+            for(int i = 0; i < 3; ++i) rgb[i] = static_cast<uint8_t>(hexDigit(literal[1 + 2*i]) * 16 + hexDigit(literal[2 + 2*i]));
+            return ansi_colors::rgb_to_ansi256(rgb[0], rgb[1], rgb[2]);
+        }
+    }
+
+    /// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+    namespace ansi_colors {
+        /// @brief The hex color literals; also available through `using namespace ansi_colors;`.
+        inline namespace literals {
+            /// @brief Returns the foreground color nearest to a `#rrggbb` hex color, computed at compile time.
+            /// @code
+            /// using namespace ansi_colors::literals;
+            /// constexpr Color accent = "#ff8800"_fg;
+            /// std::cout<< accent<< "warning"<< Reset::FgColor;
+            /// @endcode
+            consteval Color operator""_fg(const char* literal, std::size_t size){
+                return Color(__LMN_literals_helper_::hexColorCode(literal, size), false);
+            }
+
+            /// @brief Returns the background color nearest to a `#rrggbb` hex color, computed at compile time (e.g. `"#1e1e1e"_bg`).
+            consteval Color operator""_bg(const char* literal, std::size_t size){
+                return Color(__LMN_literals_helper_::hexColorCode(literal, size), true);
+            }
+        }
+    }
+#endif
+
+#endif
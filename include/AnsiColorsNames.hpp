@@ -0,0 +1,721 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher. 
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_NAMES_HPP
+#define LEMONCODE_ANSICOLORS_NAMES_HPP
+
+#include "AnsiColorsInfo.hpp"
+#include <string>
+#include <string_view>
+#include <stdexcept>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief A color name as defined by the color palettes, with its ANSI 256 color code and the `Color_Category` of its palette.
+    struct Named_Color {
+        const char* name;
+        uint8_t code;
+        uint16_t category;
+    };
+}
+
+/// @brief Helper namespace for the compile time generated (perfect hash) color name lookup table.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_color_names_perfect_hash_ {
+    using ansi_colors::Named_Color;
+    using ansi_colors::Color_Category;
+
+    /// @brief All palette member names (e.g. `Pure_Red`) and color range names (e.g. `Red6`).
+    ///        `Amber` is defined by both the Yellow and the Orange palette; the name resolves to the Yellow palette (first definition).
+    inline constexpr Named_Color names[535] = {
+        // Red palette:
+        {"std_Red",                   1, Color_Category::Red},
+        {"std_Bright_Red",            9, Color_Category::Red},
+        {"Dark_Blood_Red",            52, Color_Category::Red},
+        {"Deep_Red",                  88, Color_Category::Red},
+        {"Dark_Red",                  124, Color_Category::Red},
+        {"Bright_Red",                160, Color_Category::Red},
+        {"Rust_Red",                  167, Color_Category::Red},
+        {"Pure_Red",                  196, Color_Category::Red},
+        {"Blush_Red",                 203, Color_Category::Red},
+        {"Rosy_Red",                  210, Color_Category::Red},
+        {"Pastel_Red",                217, Color_Category::Red},
+        // RedColorRange:
+        {"Red1",                      52, Color_Category::Red},
+        {"Red2",                      88, Color_Category::Red},
+        {"Red3",                      124, Color_Category::Red},
+        {"Red4",                      1, Color_Category::Red},
+        {"Red5",                      160, Color_Category::Red},
+        {"Red6",                      196, Color_Category::Red},
+        {"Red7",                      9, Color_Category::Red},
+        {"Red8",                      167, Color_Category::Red},
+        {"Red9",                      203, Color_Category::Red},
+        {"Red10",                     210, Color_Category::Red},
+        {"Red11",                     217, Color_Category::Red},
+        // Green palette:
+        {"std_Green",                 2, Color_Category::Green},
+        {"std_Bright_Green",          10, Color_Category::Green},
+        {"Dark_Green",                22, Color_Category::Green},
+        {"Medium_Green",              28, Color_Category::Green},
+        {"Deep_Sea_Green",            29, Color_Category::Green},
+        {"Spring_Green",              34, Color_Category::Green},
+        {"Jade_Green",                35, Color_Category::Green},
+        {"Lime_Green",                40, Color_Category::Green},
+        {"Light_Spring_Green",        41, Color_Category::Green},
+        {"Caribbean_Green",           42, Color_Category::Green},
+        {"Pure_Green",                46, Color_Category::Green},
+        {"Vibrant_Spring_Green",      47, Color_Category::Green},
+        {"Soft_Spring_Green",         48, Color_Category::Green},
+        {"Brilliant_Spring_Green",    49, Color_Category::Green},
+        {"Dark_Olive_Green",          58, Color_Category::Green},
+        {"Olive_Green",               64, Color_Category::Green},
+        {"Glade_Green",               65, Color_Category::Green},
+        {"Kelly_Green",               70, Color_Category::Green},
+        {"Dark_Sea_Green",            71, Color_Category::Green},
+        {"Cadet_Green",               72, Color_Category::Green},
+        {"Strong_Green",              76, Color_Category::Green},
+        {"Moderate_Lime_Green",       77, Color_Category::Green},
+        {"Sea_Green",                 78, Color_Category::Green},
+        {"Chartreuse",                82, Color_Category::Green},
+        {"Light_Lime_Green",          83, Color_Category::Green},
+        {"Light_Sea_Green",           84, Color_Category::Green},
+        {"Luminous_Spring_Green",     85, Color_Category::Green},
+        {"Clay_Creek_Green",          101, Color_Category::Green},
+        {"Apple_Green",               106, Color_Category::Green},
+        {"Asparagus_Green",           107, Color_Category::Green},
+        {"Moss_Green",                108, Color_Category::Green},
+        {"Pistachio_Green",           112, Color_Category::Green},
+        {"Mantis_Green",              113, Color_Category::Green},
+        {"Pale_Green",                114, Color_Category::Green},
+        {"Bright_Chartreuse",         118, Color_Category::Green},
+        {"Light_Green",               119, Color_Category::Green},
+        {"Soft_Green",                120, Color_Category::Green},
+        {"Mint_Green",                121, Color_Category::Green},
+        {"Green_Yellow",              148, Color_Category::Green},
+        {"June_Bud_Green",            149, Color_Category::Green},
+        {"Pastel_Lime",               150, Color_Category::Green},
+        {"Grayish_Lime_Green",        151, Color_Category::Green},
+        {"Spring_Bud_Green",          154, Color_Category::Green},
+        {"Pastel_Sea_Green",          155, Color_Category::Green},
+        {"Seafoam_Green",             156, Color_Category::Green},
+        {"Caladon_Green",             157, Color_Category::Green},
+        {"Tea_Green",                 193, Color_Category::Green},
+        {"Pastel_Green",              194, Color_Category::Green},
+        // GreenColorRange:
+        {"Green1",                    22, Color_Category::Green},
+        {"Green2",                    58, Color_Category::Green},
+        {"Green3",                    28, Color_Category::Green},
+        {"Green4",                    29, Color_Category::Green},
+        {"Green5",                    64, Color_Category::Green},
+        {"Green6",                    65, Color_Category::Green},
+        {"Green7",                    2, Color_Category::Green},
+        {"Green8",                    34, Color_Category::Green},
+        {"Green9",                    35, Color_Category::Green},
+        {"Green10",                   101, Color_Category::Green},
+        {"Green11",                   70, Color_Category::Green},
+        {"Green12",                   71, Color_Category::Green},
+        {"Green13",                   10, Color_Category::Green},
+        {"Green14",                   40, Color_Category::Green},
+        {"Green15",                   106, Color_Category::Green},
+        {"Green16",                   72, Color_Category::Green},
+        {"Green17",                   41, Color_Category::Green},
+        {"Green18",                   107, Color_Category::Green},
+        {"Green19",                   42, Color_Category::Green},
+        {"Green20",                   108, Color_Category::Green},
+        {"Green21",                   76, Color_Category::Green},
+        {"Green22",                   77, Color_Category::Green},
+        {"Green23",                   46, Color_Category::Green},
+        {"Green24",                   112, Color_Category::Green},
+        {"Green25",                   78, Color_Category::Green},
+        {"Green26",                   47, Color_Category::Green},
+        {"Green27",                   113, Color_Category::Green},
+        {"Green28",                   148, Color_Category::Green},
+        {"Green29",                   48, Color_Category::Green},
+        {"Green30",                   114, Color_Category::Green},
+        {"Green31",                   49, Color_Category::Green},
+        {"Green32",                   149, Color_Category::Green},
+        {"Green33",                   150, Color_Category::Green},
+        {"Green34",                   82, Color_Category::Green},
+        {"Green35",                   151, Color_Category::Green},
+        {"Green36",                   83, Color_Category::Green},
+        {"Green37",                   118, Color_Category::Green},
+        {"Green38",                   84, Color_Category::Green},
+        {"Green39",                   85, Color_Category::Green},
+        {"Green40",                   119, Color_Category::Green},
+        {"Green41",                   154, Color_Category::Green},
+        {"Green42",                   120, Color_Category::Green},
+        {"Green43",                   121, Color_Category::Green},
+        {"Green44",                   155, Color_Category::Green},
+        {"Green45",                   156, Color_Category::Green},
+        {"Green46",                   157, Color_Category::Green},
+        {"Green47",                   193, Color_Category::Green},
+        {"Green48",                   194, Color_Category::Green},
+        // Blue palette:
+        {"std_Blue",                  4, Color_Category::Blue},
+        {"std_Bright_Blue",           12, Color_Category::Blue},
+        {"Dark_Navy_Blue",            17, Color_Category::Blue},
+        {"Deep_Navy_Blue",            18, Color_Category::Blue},
+        {"Navy_Blue",                 19, Color_Category::Blue},
+        {"Dark_Blue",                 20, Color_Category::Blue},
+        {"Deep_Blue",                 21, Color_Category::Blue},
+        {"Deep_Sky_Blue",             25, Color_Category::Blue},
+        {"Science_Blue",              26, Color_Category::Blue},
+        {"Pure_Blue",                 27, Color_Category::Blue},
+        {"Ocean_Blue",                32, Color_Category::Blue},
+        {"Vivid_Blue",                33, Color_Category::Blue},
+        {"Cerulean_Blue",             38, Color_Category::Blue},
+        {"Azure_Blue",                39, Color_Category::Blue},
+        {"Vivid_Sky_Blue",            45, Color_Category::Blue},
+        {"Misty_Slate_Blue",          60, Color_Category::Blue},
+        {"Comet_Blue",                61, Color_Category::Blue},
+        {"Slate_Blue",                62, Color_Category::Blue},
+        {"Bright_Blue",               63, Color_Category::Blue},
+        {"Lochmara_Blue",             67, Color_Category::Blue},
+        {"Steel_Blue",                68, Color_Category::Blue},
+        {"Light_Slate_Blue",          69, Color_Category::Blue},
+        {"Aegean_Blue",               74, Color_Category::Blue},
+        {"Iceberg_Blue",              75, Color_Category::Blue},
+        {"Dusky_Sky_Blue",            81, Color_Category::Blue},
+        {"Dusky_Cobalt_Blue",         103, Color_Category::Blue},
+        {"Soft_Indigo_Blue",          104, Color_Category::Blue},
+        {"Misty_Cornflower_Blue",     105, Color_Category::Blue},
+        {"Horizon_Blue",              110, Color_Category::Blue},
+        {"Soft_Sky_Blue",             111, Color_Category::Blue},
+        {"Light_Pearl_Blue",          146, Color_Category::Blue},
+        {"Light_Steel_Blue",          147, Color_Category::Blue},
+        {"Pastel_Blue",               153, Color_Category::Blue},
+        {"Pale_Blue",                 189, Color_Category::Blue},
+        // BlueColorRange:
+        {"Blue1",                     17, Color_Category::Blue},
+        {"Blue2",                     18, Color_Category::Blue},
+        {"Blue3",                     19, Color_Category::Blue},
+        {"Blue4",                     20, Color_Category::Blue},
+        {"Blue5",                     4, Color_Category::Blue},
+        {"Blue6",                     21, Color_Category::Blue},
+        {"Blue7",                     25, Color_Category::Blue},
+        {"Blue8",                     26, Color_Category::Blue},
+        {"Blue9",                     27, Color_Category::Blue},
+        {"Blue10",                    60, Color_Category::Blue},
+        {"Blue11",                    61, Color_Category::Blue},
+        {"Blue12",                    62, Color_Category::Blue},
+        {"Blue13",                    63, Color_Category::Blue},
+        {"Blue14",                    32, Color_Category::Blue},
+        {"Blue15",                    12, Color_Category::Blue},
+        {"Blue16",                    33, Color_Category::Blue},
+        {"Blue17",                    67, Color_Category::Blue},
+        {"Blue18",                    68, Color_Category::Blue},
+        {"Blue19",                    69, Color_Category::Blue},
+        {"Blue20",                    103, Color_Category::Blue},
+        {"Blue21",                    38, Color_Category::Blue},
+        {"Blue22",                    104, Color_Category::Blue},
+        {"Blue23",                    39, Color_Category::Blue},
+        {"Blue24",                    105, Color_Category::Blue},
+        {"Blue25",                    74, Color_Category::Blue},
+        {"Blue26",                    75, Color_Category::Blue},
+        {"Blue27",                    110, Color_Category::Blue},
+        {"Blue28",                    45, Color_Category::Blue},
+        {"Blue29",                    111, Color_Category::Blue},
+        {"Blue30",                    146, Color_Category::Blue},
+        {"Blue31",                    147, Color_Category::Blue},
+        {"Blue32",                    81, Color_Category::Blue},
+        {"Blue33",                    153, Color_Category::Blue},
+        {"Blue34",                    189, Color_Category::Blue},
+        // Cyan palette:
+        {"std_Cyan",                  6, Color_Category::Cyan},
+        {"std_Bright_Cyan",           14, Color_Category::Cyan},
+        {"Dark_Cyan",                 23, Color_Category::Cyan},
+        {"Deep_Cyan",                 24, Color_Category::Cyan},
+        {"Dark_Turquoise",            30, Color_Category::Cyan},
+        {"Medium_Turquoise",          31, Color_Category::Cyan},
+        {"Rich_Cyan",                 36, Color_Category::Cyan},
+        {"Tiffany_Cyan",              37, Color_Category::Cyan},
+        {"Lagoon_Cyan",               43, Color_Category::Cyan},
+        {"Vibrant_Turquoise",         44, Color_Category::Cyan},
+        {"Pure_Cyan",                 50, Color_Category::Cyan},
+        {"Aqua_Cyan",                 51, Color_Category::Cyan},
+        {"Juniper_Cyan",              66, Color_Category::Cyan},
+        {"Harbor_Cyan",               73, Color_Category::Cyan},
+        {"Myrtle_Cyan",               79, Color_Category::Cyan},
+        {"Tidewater_Cyan",            80, Color_Category::Cyan},
+        {"Reef_Cyan",                 86, Color_Category::Cyan},
+        {"Frost_Cyan",                87, Color_Category::Cyan},
+        {"Pewter_Cyan",               109, Color_Category::Cyan},
+        {"Sage_Cyan",                 115, Color_Category::Cyan},
+        {"Bermuda_Cyan",              116, Color_Category::Cyan},
+        {"Morning_Mist_Cyan",         117, Color_Category::Cyan},
+        {"Aquamarine_Cyan",           122, Color_Category::Cyan},
+        {"Opal_Cyan",                 123, Color_Category::Cyan},
+        {"Shallows_Cyan",             152, Color_Category::Cyan},
+        {"Algae_Cyan",                158, Color_Category::Cyan},
+        {"Glacier_Cyan",              159, Color_Category::Cyan},
+        {"Ebb_Tide_Cyan",             195, Color_Category::Cyan},
+        // CyanColorRange:
+        {"Cyan1",                     23, Color_Category::Cyan},
+        {"Cyan2",                     24, Color_Category::Cyan},
+        {"Cyan3",                     6, Color_Category::Cyan},
+        {"Cyan4",                     30, Color_Category::Cyan},
+        {"Cyan5",                     31, Color_Category::Cyan},
+        {"Cyan6",                     66, Color_Category::Cyan},
+        {"Cyan7",                     36, Color_Category::Cyan},
+        {"Cyan8",                     37, Color_Category::Cyan},
+        {"Cyan9",                     73, Color_Category::Cyan},
+        {"Cyan10",                    43, Color_Category::Cyan},
+        {"Cyan11",                    109, Color_Category::Cyan},
+        {"Cyan12",                    44, Color_Category::Cyan},
+        {"Cyan13",                    79, Color_Category::Cyan},
+        {"Cyan14",                    14, Color_Category::Cyan},
+        {"Cyan15",                    80, Color_Category::Cyan},
+        {"Cyan16",                    115, Color_Category::Cyan},
+        {"Cyan17",                    50, Color_Category::Cyan},
+        {"Cyan18",                    116, Color_Category::Cyan},
+        {"Cyan19",                    51, Color_Category::Cyan},
+        {"Cyan20",                    117, Color_Category::Cyan},
+        {"Cyan21",                    152, Color_Category::Cyan},
+        {"Cyan22",                    86, Color_Category::Cyan},
+        {"Cyan23",                    87, Color_Category::Cyan},
+        {"Cyan24",                    122, Color_Category::Cyan},
+        {"Cyan25",                    123, Color_Category::Cyan},
+        {"Cyan26",                    158, Color_Category::Cyan},
+        {"Cyan27",                    159, Color_Category::Cyan},
+        {"Cyan28",                    195, Color_Category::Cyan},
+        // Yellow palette:
+        {"std_Yellow",                3, Color_Category::Yellow},
+        {"std_Bright_Yellow",         11, Color_Category::Yellow},
+        {"Mustard_Yellow",            100, Color_Category::Yellow},
+        {"Light_Gold",                142, Color_Category::Yellow},
+        {"Dark_Khaki",                143, Color_Category::Yellow},
+        {"Light_Khaki",               144, Color_Category::Yellow},
+        {"Deep_Yellow",               178, Color_Category::Yellow},
+        {"Strong_Yellow",             184, Color_Category::Yellow},
+        {"Mellow_Yellow",             185, Color_Category::Yellow},
+        {"Muted_Yellow",              186, Color_Category::Yellow},
+        {"Soft_Yellow",               187, Color_Category::Yellow},
+        {"Neon_Yellow",               190, Color_Category::Yellow},
+        {"Bright_Lemon",              191, Color_Category::Yellow},
+        {"Lemon_Lime",                192, Color_Category::Yellow},
+        {"Amber",                     220, Color_Category::Yellow},
+        {"Honey_Yellow",              221, Color_Category::Yellow},
+        {"Marigold_Yellow",           222, Color_Category::Yellow},
+        {"Pure_Yellow",               226, Color_Category::Yellow},
+        {"Golden_Yellow",             227, Color_Category::Yellow},
+        {"Pastel_Yellow",             228, Color_Category::Yellow},
+        {"Light_Yellow",              229, Color_Category::Yellow},
+        {"Pale_Yellow",               230, Color_Category::Yellow},
+        // YellowColorRange:
+        {"Yellow1",                   100, Color_Category::Yellow},
+        {"Yellow2",                   3, Color_Category::Yellow},
+        {"Yellow3",                   142, Color_Category::Yellow},
+        {"Yellow4",                   143, Color_Category::Yellow},
+        {"Yellow5",                   178, Color_Category::Yellow},
+        {"Yellow6",                   144, Color_Category::Yellow},
+        {"Yellow7",                   184, Color_Category::Yellow},
+        {"Yellow8",                   185, Color_Category::Yellow},
+        {"Yellow9",                   220, Color_Category::Yellow},
+        {"Yellow10",                  186, Color_Category::Yellow},
+        {"Yellow11",                  187, Color_Category::Yellow},
+        {"Yellow12",                  221, Color_Category::Yellow},
+        {"Yellow13",                  222, Color_Category::Yellow},
+        {"Yellow14",                  190, Color_Category::Yellow},
+        {"Yellow15",                  191, Color_Category::Yellow},
+        {"Yellow16",                  11, Color_Category::Yellow},
+        {"Yellow17",                  226, Color_Category::Yellow},
+        {"Yellow18",                  192, Color_Category::Yellow},
+        {"Yellow19",                  227, Color_Category::Yellow},
+        {"Yellow20",                  228, Color_Category::Yellow},
+        {"Yellow21",                  229, Color_Category::Yellow},
+        {"Yellow22",                  230, Color_Category::Yellow},
+        // Purple palette:
+        {"std_Purple",                5, Color_Category::Purple},
+        {"Imperial_Purple",           53, Color_Category::Purple},
+        {"Velvet_Plum_Purple",        90, Color_Category::Purple},
+        {"Mystic_Amethyst_Purple",    91, Color_Category::Purple},
+        {"Smokey_Orchid_Purple",      96, Color_Category::Purple},
+        {"Velvet_Magenta_Purple",     126, Color_Category::Purple},
+        {"Heliotrope_Purple",         127, Color_Category::Purple},
+        {"Orchid_Purple",             128, Color_Category::Purple},
+        {"Fuchsia_Purple",            129, Color_Category::Purple},
+        {"Lilac_Purple",              133, Color_Category::Purple},
+        {"Heather_Purple",            134, Color_Category::Purple},
+        {"Mauve_Purple",              139, Color_Category::Purple},
+        {"Electric_Fuchsia_Purple",   164, Color_Category::Purple},
+        {"Orchid_Magenta_Purple",     165, Color_Category::Purple},
+        {"Light_Magenta_Purple",      170, Color_Category::Purple},
+        {"Haze_Purple",               171, Color_Category::Purple},
+        {"Pastel_Orchid_Purple",      176, Color_Category::Purple},
+        {"Radiant_Amethyst_Purple",   201, Color_Category::Purple},
+        {"Pastel_Fuchsia_Purple",     207, Color_Category::Purple},
+        {"Cotton_Candy_Purple",       213, Color_Category::Purple},
+        {"Pastel_Plum_Purple",        219, Color_Category::Purple},
+        {"Pale_Lilac_Purple",         225, Color_Category::Purple},
+        // PurpleColorRange:
+        {"Purple1",                   53, Color_Category::Purple},
+        {"Purple2",                   90, Color_Category::Purple},
+        {"Purple3",                   5, Color_Category::Purple},
+        {"Purple4",                   91, Color_Category::Purple},
+        {"Purple5",                   126, Color_Category::Purple},
+        {"Purple6",                   127, Color_Category::Purple},
+        {"Purple7",                   128, Color_Category::Purple},
+        {"Purple8",                   129, Color_Category::Purple},
+        {"Purple9",                   164, Color_Category::Purple},
+        {"Purple10",                  165, Color_Category::Purple},
+        {"Purple11",                  201, Color_Category::Purple},
+        {"Purple12",                  96, Color_Category::Purple},
+        {"Purple13",                  133, Color_Category::Purple},
+        {"Purple14",                  134, Color_Category::Purple},
+        {"Purple15",                  170, Color_Category::Purple},
+        {"Purple16",                  171, Color_Category::Purple},
+        {"Purple17",                  207, Color_Category::Purple},
+        {"Purple18",                  139, Color_Category::Purple},
+        {"Purple19",                  176, Color_Category::Purple},
+        {"Purple20",                  213, Color_Category::Purple},
+        {"Purple21",                  219, Color_Category::Purple},
+        {"Purple22",                  225, Color_Category::Purple},
+        // Orange palette:
+        {"Dark_Orange",               130, Color_Category::Orange},
+        {"Strong_Orange",             166, Color_Category::Orange},
+        {"Burnt_Orange",              172, Color_Category::Orange},
+        {"Pure_Orange",               202, Color_Category::Orange},
+        {"Coral_Orange",              209, Color_Category::Orange},
+        {"Golden_Orange",             214, Color_Category::Orange},
+        {"Sandy_Orange",              215, Color_Category::Orange},
+        {"Light_Salmon_Orange",       216, Color_Category::Orange},
+        // OrangeColorRange:
+        {"Orange1",                   130, Color_Category::Orange},
+        {"Orange2",                   166, Color_Category::Orange},
+        {"Orange3",                   202, Color_Category::Orange},
+        {"Orange4",                   172, Color_Category::Orange},
+        {"Orange5",                   208, Color_Category::Orange},
+        {"Orange6",                   209, Color_Category::Orange},
+        {"Orange7",                   214, Color_Category::Orange},
+        {"Orange8",                   215, Color_Category::Orange},
+        {"Orange9",                   216, Color_Category::Orange},
+        // Brown palette:
+        {"Russet_Brown",              94, Color_Category::Brown},
+        {"Brick_Rose_Brown",          95, Color_Category::Brown},
+        {"Chestnut_Brown",            131, Color_Category::Brown},
+        {"Dark_Goldenrod_Brown",      136, Color_Category::Brown},
+        {"Desert_Sand_Brown",         137, Color_Category::Brown},
+        {"Dusty_Taupe_Brown",         138, Color_Category::Brown},
+        {"Copperfield_Brown",         173, Color_Category::Brown},
+        {"Sandstone_Brown",           179, Color_Category::Brown},
+        {"Light_Sandstone_Brown",     180, Color_Category::Brown},
+        {"Pale_Chestnut_Brown",       181, Color_Category::Brown},
+        {"Pastel_Moccasin_Brown",     223, Color_Category::Brown},
+        // BrownColorRange:
+        {"Brown1",                    94, Color_Category::Brown},
+        {"Brown2",                    95, Color_Category::Brown},
+        {"Brown3",                    131, Color_Category::Brown},
+        {"Brown4",                    136, Color_Category::Brown},
+        {"Brown5",                    137, Color_Category::Brown},
+        {"Brown6",                    138, Color_Category::Brown},
+        {"Brown7",                    173, Color_Category::Brown},
+        {"Brown8",                    179, Color_Category::Brown},
+        {"Brown9",                    180, Color_Category::Brown},
+        {"Brown10",                   181, Color_Category::Brown},
+        {"Brown11",                   223, Color_Category::Brown},
+        // Violet palette:
+        {"Deep_Orchid_Violet",        54, Color_Category::Violet},
+        {"Amethyst_Violet",           55, Color_Category::Violet},
+        {"Orchid_Violet",             56, Color_Category::Violet},
+        {"Blue_Violet",               57, Color_Category::Violet},
+        {"Strong_Violet",             92, Color_Category::Violet},
+        {"Electric_Violet",           93, Color_Category::Violet},
+        {"Smokey_Amethyst_Violet",    97, Color_Category::Violet},
+        {"Dusty_Lavender_Violet",     98, Color_Category::Violet},
+        {"Munstead_Violet",           99, Color_Category::Violet},
+        {"Light_Violet",              135, Color_Category::Violet},
+        {"Hazy_Lilac_Violet",         140, Color_Category::Violet},
+        {"Lavender_Violet",           141, Color_Category::Violet},
+        {"Misty_Lavender_Violet",     177, Color_Category::Violet},
+        {"Frosted_Lavender_Violet",   182, Color_Category::Violet},
+        {"Pearl_Violet",              183, Color_Category::Violet},
+        // VioletColorRange:
+        {"Violet1",                   54, Color_Category::Violet},
+        {"Violet2",                   55, Color_Category::Violet},
+        {"Violet3",                   56, Color_Category::Violet},
+        {"Violet4",                   57, Color_Category::Violet},
+        {"Violet5",                   92, Color_Category::Violet},
+        {"Violet6",                   93, Color_Category::Violet},
+        {"Violet7",                   97, Color_Category::Violet},
+        {"Violet8",                   98, Color_Category::Violet},
+        {"Violet9",                   99, Color_Category::Violet},
+        {"Violet10",                  135, Color_Category::Violet},
+        {"Violet11",                  140, Color_Category::Violet},
+        {"Violet12",                  141, Color_Category::Violet},
+        {"Violet13",                  177, Color_Category::Violet},
+        {"Violet14",                  182, Color_Category::Violet},
+        {"Violet15",                  183, Color_Category::Violet},
+        // Pink palette:
+        {"std_Pink",                  13, Color_Category::Pink},
+        {"Dark_Pink",                 89, Color_Category::Pink},
+        {"Raspberry_Rose_Pink",       125, Color_Category::Pink},
+        {"Peony_Pink",                132, Color_Category::Pink},
+        {"Vivid_Pink",                161, Color_Category::Pink},
+        {"Deep_Fuchsia_Pink",         162, Color_Category::Pink},
+        {"Fuchsia_Pink",              163, Color_Category::Pink},
+        {"Rosebud_Pink",              168, Color_Category::Pink},
+        {"Dreamy_Raspberry_Pink",     169, Color_Category::Pink},
+        {"Blush_Rose_Pink",           174, Color_Category::Pink},
+        {"Rose_Quartz_Pink",          175, Color_Category::Pink},
+        {"Vivid_Raspberry_Pink",      197, Color_Category::Pink},
+        {"Neon_Rose_Pink",            198, Color_Category::Pink},
+        {"Dragonfruit_Pink",          199, Color_Category::Pink},
+        {"Electric_Magenta_Pink",     200, Color_Category::Pink},
+        {"Watermelon_Candy_Pink",     204, Color_Category::Pink},
+        {"Cherry_Blossom_Pink",       205, Color_Category::Pink},
+        {"Silk_Rose_Pink",            206, Color_Category::Pink},
+        {"Tickle_Me_Pink",            211, Color_Category::Pink},
+        {"Princess_Perfume_Pink",     212, Color_Category::Pink},
+        {"Rosewater_Pink",            218, Color_Category::Pink},
+        {"Powder_Pink",               224, Color_Category::Pink},
+        // PinkColorRange:
+        {"Pink1",                     89, Color_Category::Pink},
+        {"Pink2",                     125, Color_Category::Pink},
+        {"Pink3",                     13, Color_Category::Pink},
+        {"Pink4",                     161, Color_Category::Pink},
+        {"Pink5",                     162, Color_Category::Pink},
+        {"Pink6",                     163, Color_Category::Pink},
+        {"Pink7",                     197, Color_Category::Pink},
+        {"Pink8",                     198, Color_Category::Pink},
+        {"Pink9",                     199, Color_Category::Pink},
+        {"Pink10",                    200, Color_Category::Pink},
+        {"Pink11",                    132, Color_Category::Pink},
+        {"Pink12",                    168, Color_Category::Pink},
+        {"Pink13",                    169, Color_Category::Pink},
+        {"Pink14",                    204, Color_Category::Pink},
+        {"Pink15",                    205, Color_Category::Pink},
+        {"Pink16",                    206, Color_Category::Pink},
+        {"Pink17",                    174, Color_Category::Pink},
+        {"Pink18",                    175, Color_Category::Pink},
+        {"Pink19",                    211, Color_Category::Pink},
+        {"Pink20",                    212, Color_Category::Pink},
+        {"Pink21",                    218, Color_Category::Pink},
+        {"Pink22",                    224, Color_Category::Pink},
+        // Black palette:
+        {"std_Black",                 0, Color_Category::Black},
+        {"Extended_Black",            16, Color_Category::Black},
+        {"Vampire_Black",             232, Color_Category::Black},
+        {"Nightshade_Black",          233, Color_Category::Black},
+        // BlackColorRange:
+        {"Black1",                    16, Color_Category::Black},
+        {"Black2",                    232, Color_Category::Black},
+        {"Black3",                    0, Color_Category::Black},
+        {"Black4",                    233, Color_Category::Black},
+        // Gray palette:
+        {"std_Gray",                  8, Color_Category::Gray},
+        {"Granite_Gray",              59, Color_Category::Gray},
+        {"Smoke_Gray",                102, Color_Category::Gray},
+        {"Fog_Gray",                  145, Color_Category::Gray},
+        {"Frosted_Gray",              188, Color_Category::Gray},
+        {"Soot_Gray",                 234, Color_Category::Gray},
+        {"Graphite_Gray",             235, Color_Category::Gray},
+        {"Charcoal_Gray",             236, Color_Category::Gray},
+        {"Dusty_Charcoal_Gray",       237, Color_Category::Gray},
+        {"Slate_Gray",                238, Color_Category::Gray},
+        {"Gravel_Gray",               239, Color_Category::Gray},
+        {"Shadow_Gray",               240, Color_Category::Gray},
+        {"Nickel_Gray",               241, Color_Category::Gray},
+        {"Mercury_Gray",              242, Color_Category::Gray},
+        {"Dove_Gray",                 243, Color_Category::Gray},
+        {"Flint_Gray",                244, Color_Category::Gray},
+        {"Driftwood_Gray",            245, Color_Category::Gray},
+        {"Stone_Gray",                246, Color_Category::Gray},
+        {"Silver_Gray",               247, Color_Category::Gray},
+        {"Concrete_Gray",             248, Color_Category::Gray},
+        {"Aluminum_Gray",             249, Color_Category::Gray},
+        {"Silver_Foil_Gray",          250, Color_Category::Gray},
+        {"Chalk_Gray",                251, Color_Category::Gray},
+        {"Marble_Gray",               252, Color_Category::Gray},
+        {"Porcelain_Gray",            253, Color_Category::Gray},
+        {"Snow_Gray",                 254, Color_Category::Gray},
+        // GrayColorRange:
+        {"Gray1",                     234, Color_Category::Gray},
+        {"Gray2",                     235, Color_Category::Gray},
+        {"Gray3",                     236, Color_Category::Gray},
+        {"Gray4",                     237, Color_Category::Gray},
+        {"Gray5",                     238, Color_Category::Gray},
+        {"Gray6",                     239, Color_Category::Gray},
+        {"Gray7",                     240, Color_Category::Gray},
+        {"Gray8",                     59, Color_Category::Gray},
+        {"Gray9",                     241, Color_Category::Gray},
+        {"Gray10",                    242, Color_Category::Gray},
+        {"Gray11",                    243, Color_Category::Gray},
+        {"Gray12",                    8, Color_Category::Gray},
+        {"Gray13",                    244, Color_Category::Gray},
+        {"Gray14",                    102, Color_Category::Gray},
+        {"Gray15",                    245, Color_Category::Gray},
+        {"Gray16",                    246, Color_Category::Gray},
+        {"Gray17",                    247, Color_Category::Gray},
+        {"Gray18",                    248, Color_Category::Gray},
+        {"Gray19",                    145, Color_Category::Gray},
+        {"Gray20",                    249, Color_Category::Gray},
+        {"Gray21",                    250, Color_Category::Gray},
+        {"Gray22",                    251, Color_Category::Gray},
+        {"Gray23",                    252, Color_Category::Gray},
+        {"Gray24",                    188, Color_Category::Gray},
+        {"Gray25",                    253, Color_Category::Gray},
+        {"Gray26",                    254, Color_Category::Gray},
+        // White palette:
+        {"std_White",                 7, Color_Category::White},
+        {"Snowflake_White",           15, Color_Category::White},
+        {"Pure_White",                231, Color_Category::White},
+        {"Pearl_White",               255, Color_Category::White},
+        // WhiteColorRange:
+        {"White1",                    7, Color_Category::White},
+        {"White2",                    255, Color_Category::White},
+        {"White3",                    15, Color_Category::White},
+        {"White4",                    231, Color_Category::White},
+        // Shades palette:
+        {"Shade1",                    232, Color_Category::GrayScale},
+        {"Shade2",                    233, Color_Category::GrayScale},
+        {"Shade3",                    234, Color_Category::GrayScale},
+        {"Shade4",                    235, Color_Category::GrayScale},
+        {"Shade5",                    236, Color_Category::GrayScale},
+        {"Shade6",                    237, Color_Category::GrayScale},
+        {"Shade7",                    238, Color_Category::GrayScale},
+        {"Shade8",                    239, Color_Category::GrayScale},
+        {"Shade9",                    240, Color_Category::GrayScale},
+        {"Shade10",                   241, Color_Category::GrayScale},
+        {"Shade11",                   242, Color_Category::GrayScale},
+        {"Shade12",                   243, Color_Category::GrayScale},
+        {"Shade13",                   244, Color_Category::GrayScale},
+        {"Shade14",                   245, Color_Category::GrayScale},
+        {"Shade15",                   246, Color_Category::GrayScale},
+        {"Shade16",                   247, Color_Category::GrayScale},
+        {"Shade17",                   248, Color_Category::GrayScale},
+        {"Shade18",                   249, Color_Category::GrayScale},
+        {"Shade19",                   250, Color_Category::GrayScale},
+        {"Shade20",                   251, Color_Category::GrayScale},
+        {"Shade21",                   252, Color_Category::GrayScale},
+        {"Shade22",                   253, Color_Category::GrayScale},
+        {"Shade23",                   254, Color_Category::GrayScale},
+        {"Shade24",                   255, Color_Category::GrayScale}
+    };
+
+    inline constexpr std::size_t name_count = sizeof(names) / sizeof(names[0]);
+    inline constexpr std::size_t bucket_count = 256;
+    inline constexpr std::size_t slot_count = 1024;
+    inline constexpr uint16_t empty_slot = 0xFFFF;
+
+    /// @brief Seeded FNV-1a hash with a final avalanche step, so that every seed yields an independent slot distribution.
+    inline constexpr uint32_t hash(std::string_view key, uint32_t seed) noexcept {
+        uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+        for(char c : key){
+            h ^= static_cast<uint8_t>(c);
+            h *= 16777619u;
+        }
+        h ^= h >> 16;
+        h *= 0x85EBCA6Bu;
+        h ^= h >> 13;
+        return h;
+    }
+
+    /// @brief Hash and displace table: the first hash selects a bucket, the bucket's seed selects a unique slot for every name.
+    struct Table {
+        uint16_t seed[bucket_count];
+        uint16_t slot[slot_count];
+    };
+
+    /// @brief Builds the perfect hash table; evaluated once at compile time.
+    inline constexpr Table build() noexcept {
+        Table table{};
+        for(std::size_t s = 0; s < slot_count; ++s) table.slot[s] = empty_slot;
+
+        uint16_t bucket_of[name_count]{};
+        uint16_t bucket_size[bucket_count]{};
+        for(std::size_t i = 0; i < name_count; ++i){
+            bucket_of[i] = static_cast<uint16_t>(hash(names[i].name, 0) % bucket_count);
+            ++bucket_size[bucket_of[i]];
+        }
+
+        // Place the largest buckets first, they are the hardest to fit.
+        uint16_t order[bucket_count]{};
+        for(std::size_t b = 0; b < bucket_count; ++b) order[b] = static_cast<uint16_t>(b);
+        for(std::size_t i = 1; i < bucket_count; ++i){
+            for(std::size_t j = i; j > 0 && bucket_size[order[j - 1]] < bucket_size[order[j]]; --j){
+                uint16_t tmp = order[j];
+                order[j] = order[j - 1];
+                order[j - 1] = tmp;
+            }
+        }
+
+        for(std::size_t o = 0; o < bucket_count && bucket_size[order[o]] != 0; ++o){
+            const uint16_t bucket = order[o];
+            uint16_t members[name_count]{};
+            std::size_t member_count = 0;
+            for(std::size_t i = 0; i < name_count; ++i){
+                if(bucket_of[i] == bucket) members[member_count++] = static_cast<uint16_t>(i);
+            }
+
+            for(uint32_t seed = 1;; ++seed){
+                uint16_t slots[name_count]{};
+                bool fits = true;
+                for(std::size_t m = 0; m < member_count && fits; ++m){
+                    slots[m] = static_cast<uint16_t>(hash(names[members[m]].name, seed) & (slot_count - 1));
+                    if(table.slot[slots[m]] != empty_slot) fits = false;
+                    for(std::size_t k = 0; k < m && fits; ++k){
+                        if(slots[k] == slots[m]) fits = false;
+                    }
+                }
+                if(!fits) continue;
+
+                table.seed[bucket] = static_cast<uint16_t>(seed);
+                for(std::size_t m = 0; m < member_count; ++m) table.slot[slots[m]] = members[m];
+                break;
+            }
+        }
+        return table;
+    }
+
+    inline constexpr Table table = build();
+
+    /// @brief Resolves a name to its entry in `names`, or nullptr if the name is not defined.
+    inline constexpr const Named_Color* find(std::string_view name) noexcept {
+        const uint32_t bucket = hash(name, 0) % bucket_count;
+        const uint16_t index = table.slot[hash(name, table.seed[bucket]) & (slot_count - 1)];
+        if(index == empty_slot || name != names[index].name) return nullptr;
+        return &names[index];
+    }
+
+    /// @brief Compile time check that every name resolves to itself.
+    inline constexpr bool verify() noexcept {
+        for(std::size_t i = 0; i < name_count; ++i){
+            if(find(names[i].name) != &names[i]) return false;
+        }
+        return true;
+    }
+    static_assert(verify(), "The color name table contains duplicate names.");
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Looks up a color by its palette member name (e.g. `Pure_Red`, `Snowflake_White`) or color range name (e.g. `Red3`, `Shade12`).
+    ///        The lookup is a single perfect hash probe with one string compare and can be used in constant expressions.
+    /// @param name The (case sensitive) color name.
+    /// @return A pointer to the `Named_Color` entry, or nullptr if the name is not defined.
+    inline constexpr const Named_Color* find_color(std::string_view name) noexcept {
+        return __LMN_color_names_perfect_hash_::find(name);
+    }
+
+    /// @brief Creates a `Color` from its palette member name or color range name.
+    /// @param name The (case sensitive) color name.
+    /// @param bg_color If true, the color is applied as a background; if false, as a foreground color.
+    /// @return The `Color` with the code of the given name.
+    /// @throws std::invalid_argument if the name is not defined.
+    inline Color color_from_name(std::string_view name, bool bg_color){
+        const Named_Color* named = find_color(name);
+        if(named == nullptr){
+            throw std::invalid_argument("\nERROR: Unknown color name '"+std::string(name)+"' in function 'color_from_name()'\n");
+        }
+        return Color(named->code, bg_color);
+    }
+}
+
+#endif
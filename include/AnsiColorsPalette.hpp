@@ -0,0 +1,1229 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_PALETTE_HPP
+#define LEMONCODE_ANSICOLORS_PALETTE_HPP
+
+// The named color palettes (`fg::` and `bg::`). Like the core, it does not depend on <iostream>.
+//
+// Every palette is an instance of one class template, `Color_Palette`, driven by a data structure per palette:
+// the color codes of its range (sorted from dark to light) and its uniquely named colors. All palettes are constexpr,
+// so including this header adds no dynamic initialization to a translation unit.
+
+#include "AnsiColorsCore.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/// @brief  Helper namespace for the color definitions in the ansi_colors namespace.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_color_categories_defined_ {
+    using ansi_colors::Color;
+
+    /// @brief Helper method for checking if the given index isn't out of range, else it will throw an instance of 'std::out_of_range' with an appropriate error message.
+    /// @param group The color group of the caller (e.g. "PrimaryColors").
+    /// @param classInstance The class (color palette color) name of the caller method/ operator; a one letter name is a `ShortCut` palette.
+    /// @param index The given index.
+    /// @param max_index The maximum index.
+    /// @param at True in case the caller is the .at() method. Default = false.
+    inline void checkForOutOfRange(const char* group, const char* classInstance, uint8_t index, uint8_t max_index, bool at = false){
+        if(index > 0 && index <= max_index) return;
+        // Only build the error message when it's needed, so that valid indexing never allocates.
+        const std::string instance = classInstance;
+        auto getOperator = [&instance]() -> std::string {
+            return (instance.length() == 1 ? "->" : ".");
+        };
+        auto getErrorStart = [&]() -> std::string {
+            if(at){
+                return "\nERROR: Illegal index in method '"+std::string(group)+getOperator()+instance+".at("+std::to_string(index)+")'";
+            } else {
+                return "\nERROR: Illegal index in operator '"+std::string(group)+getOperator()+instance+"["+std::to_string(index)+"]'";
+            }
+        };
+        if(index == 0){
+            throw std::out_of_range(getErrorStart()+"\n\n\t-Indexing starts at 1 (corresponding to the first color palette name) and aligns with the member color definition names.\n");
+        } else {
+            throw std::out_of_range(getErrorStart()+"\n\n\t-Your index exceeds the available color range (1 - "+std::to_string(max_index)+")\n");
+        }
+    }
+
+    /// @brief The colors of a palette range as a constexpr array, built from the color codes in `Data::range`.
+    template<typename Data, bool BgColor, typename = std::make_index_sequence<sizeof(Data::range) / sizeof(Data::range[0])>>
+    struct Palette_Colors;
+
+    template<typename Data, bool BgColor, std::size_t... I>
+    struct Palette_Colors<Data, BgColor, std::index_sequence<I...>> {
+        inline static constexpr uint8_t size = static_cast<uint8_t>(sizeof...(I));
+        inline static constexpr Color values[sizeof...(I)] = {Color(Data::range[I], BgColor)...};
+    };
+
+    /// @brief A palette range: the colors of a palette sorted from dark to light, which uses a different naming scheme
+    ///        (e.g. Red1 - Red11, inherited from `Data::Range_Names`) and provides its own index operator and STL-style iteration methods.
+    /// @tparam Data The palette data (e.g. `Red_Palette`).
+    /// @tparam BgColor True for the background palette, false for the foreground (text) palette.
+    template<typename Data, bool BgColor>
+    class Color_Range : public Data::template Range_Names<BgColor> {
+        typedef Palette_Colors<Data, BgColor> Colors;
+        bool short_cut;
+    public:
+        Color_Range() noexcept = delete;
+        constexpr explicit Color_Range(bool short_cut) noexcept : short_cut(short_cut){}
+
+        /// @brief Retrieves a color by its 1-based index using the [] operator.
+        /// @param index The 1-based index of the desired color.
+        /// @return A reference to the corresponding Color object.
+        /// @throws std::out_of_range if the index is outside the valid range.
+        const Color&operator[](uint8_t index) const {
+            checkForOutOfRange(Data::group, (short_cut ? Data::short_name : Data::name), index, Colors::size);
+            return Colors::values[index - 1];
+        }
+
+        /// @brief Retrieves a color by its 1-based index with bounds checking.
+        /// @param index The 1-based index of the desired color.
+        /// @return A reference to the corresponding Color object.
+        /// @throws std::out_of_range if the index is outside the valid range.
+        const Color& at(uint8_t index) const {
+            checkForOutOfRange(Data::group, (short_cut ? Data::short_name : Data::name), index, Colors::size, true);
+            return Colors::values[index - 1];
+        }
+
+        /// @brief Returns a const iterator to the first (darkest) color, enabling range-based for loops.
+        constexpr const Color* begin() const noexcept { return Colors::values; }
+
+        /// @brief Returns a const iterator one past the last (lightest) color, enabling range-based for loops.
+        constexpr const Color* end() const noexcept { return Colors::values + Colors::size; }
+    };
+
+    /// @brief A color palette: uniquely named colors (e.g. Pure_Red, inherited from `Data::Names`) and a range, sorted from dark to light,
+    ///        that is indexed and iterated directly or through `operator->()`.
+    /// @tparam Data The palette data (e.g. `Red_Palette`).
+    /// @tparam BgColor True for the background palette, false for the foreground (text) palette.
+    template<typename Data, bool BgColor>
+    class Color_Palette : public Data::template Names<BgColor> {
+        Color_Range<Data, BgColor> range;
+    public:
+        Color_Palette() noexcept = delete;
+        constexpr explicit Color_Palette(bool short_cut) noexcept : range(short_cut){}
+
+        /// @brief Enables range-based for loops over the range of this palette.
+        constexpr const Color* begin() const noexcept { return range.begin(); }
+
+        /// @brief Enables range-based for loops over the range of this palette.
+        constexpr const Color* end() const noexcept { return range.end(); }
+
+        /// @brief Retrieves a color by its 1-based index from the range of this palette, with bounds checking.
+        /// @throws std::out_of_range if the index is outside the valid range.
+        const Color&operator[](uint8_t index) const { return range[index]; }
+
+        /// @brief Retrieves a color by its 1-based index from the range of this palette, with bounds checking.
+        /// @throws std::out_of_range if the index is outside the valid range.
+        const Color& at(uint8_t index) const { return range.at(index); }
+
+        /// @brief Overload of `operator->()` to access the range of this palette, which is sorted from dark to light, uses a different
+        ///        naming scheme, and provides its own index operator (`operator[](uint8_t)`) and STL-style iteration methods.
+        constexpr const Color_Range<Data, BgColor>* operator->() const noexcept { return &range; }
+
+        /// @brief Returns the color that stands for this palette when it's streamed (AnsiColorsStream.hpp) or formatted (AnsiColorsFormat.hpp).
+        constexpr const Color& defaultColor() const noexcept { return Data::template default_color<BgColor>(); }
+    };
+
+    /// @brief The data of the Red palettes: the Red range (`operator->()`) and the uniquely named Red colors.
+    struct Red_Palette {
+        typedef Defined_Colors::Red RED;
+        inline static constexpr const char* group = "PrimaryColors";
+        inline static constexpr const char* name = "Red";
+        inline static constexpr const char* short_name = "R";
+
+        /// @brief The color codes of the range (Red1 - Red11), sorted from dark to light.
+        inline static constexpr RED range[] = {
+            RED::Red52, RED::Red88, RED::Red124, RED::Red1, RED::Red160, RED::Red196,
+            RED::Red9, RED::Red167, RED::Red203, RED::Red210, RED::Red217
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Red_Palette, BgColor> Colors;
+            inline static constexpr const Color& Red1  = Colors::values[0];
+            inline static constexpr const Color& Red2  = Colors::values[1];
+            inline static constexpr const Color& Red3  = Colors::values[2];
+            inline static constexpr const Color& Red4  = Colors::values[3];
+            inline static constexpr const Color& Red5  = Colors::values[4];
+            inline static constexpr const Color& Red6  = Colors::values[5];
+            inline static constexpr const Color& Red7  = Colors::values[6];
+            inline static constexpr const Color& Red8  = Colors::values[7];
+            inline static constexpr const Color& Red9  = Colors::values[8];
+            inline static constexpr const Color& Red10 = Colors::values[9];
+            inline static constexpr const Color& Red11 = Colors::values[10];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Red        {RED::Red1, BgColor};
+            inline static constexpr Color std_Bright_Red {RED::Red9, BgColor};
+            inline static constexpr Color Dark_Blood_Red {RED::Red52, BgColor};
+            inline static constexpr Color Deep_Red       {RED::Red88, BgColor};
+            inline static constexpr Color Dark_Red       {RED::Red124, BgColor};
+            inline static constexpr Color Bright_Red     {RED::Red160, BgColor};
+            inline static constexpr Color Rust_Red       {RED::Red167, BgColor};
+            inline static constexpr Color Pure_Red       {RED::Red196, BgColor};
+            inline static constexpr Color Blush_Red      {RED::Red203, BgColor};
+            inline static constexpr Color Rosy_Red       {RED::Red210, BgColor};
+            inline static constexpr Color Pastel_Red     {RED::Red217, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_Red; }
+    };
+
+    /// @brief The data of the Green palettes: the Green range (`operator->()`) and the uniquely named Green colors.
+    struct Green_Palette {
+        typedef Defined_Colors::Green GREEN;
+        inline static constexpr const char* group = "PrimaryColors";
+        inline static constexpr const char* name = "Green";
+        inline static constexpr const char* short_name = "G";
+
+        /// @brief The color codes of the range (Green1 - Green48), sorted from dark to light.
+        inline static constexpr GREEN range[] = {
+            GREEN::Green22, GREEN::Green58, GREEN::Green28, GREEN::Green29, GREEN::Green64, GREEN::Green65,
+            GREEN::Green2, GREEN::Green34, GREEN::Green35, GREEN::Green101, GREEN::Green70, GREEN::Green71,
+            GREEN::Green10, GREEN::Green40, GREEN::Green106, GREEN::Green72, GREEN::Green41, GREEN::Green107,
+            GREEN::Green42, GREEN::Green108, GREEN::Green76, GREEN::Green77, GREEN::Green46, GREEN::Green112,
+            GREEN::Green78, GREEN::Green47, GREEN::Green113, GREEN::Green148, GREEN::Green48, GREEN::Green114,
+            GREEN::Green49, GREEN::Green149, GREEN::Green150, GREEN::Green82, GREEN::Green151, GREEN::Green83,
+            GREEN::Green118, GREEN::Green84, GREEN::Green85, GREEN::Green119, GREEN::Green154, GREEN::Green120,
+            GREEN::Green121, GREEN::Green155, GREEN::Green156, GREEN::Green157, GREEN::Green193, GREEN::Green194
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Green_Palette, BgColor> Colors;
+            inline static constexpr const Color& Green1  = Colors::values[0];
+            inline static constexpr const Color& Green2  = Colors::values[1];
+            inline static constexpr const Color& Green3  = Colors::values[2];
+            inline static constexpr const Color& Green4  = Colors::values[3];
+            inline static constexpr const Color& Green5  = Colors::values[4];
+            inline static constexpr const Color& Green6  = Colors::values[5];
+            inline static constexpr const Color& Green7  = Colors::values[6];
+            inline static constexpr const Color& Green8  = Colors::values[7];
+            inline static constexpr const Color& Green9  = Colors::values[8];
+            inline static constexpr const Color& Green10 = Colors::values[9];
+            inline static constexpr const Color& Green11 = Colors::values[10];
+            inline static constexpr const Color& Green12 = Colors::values[11];
+            inline static constexpr const Color& Green13 = Colors::values[12];
+            inline static constexpr const Color& Green14 = Colors::values[13];
+            inline static constexpr const Color& Green15 = Colors::values[14];
+            inline static constexpr const Color& Green16 = Colors::values[15];
+            inline static constexpr const Color& Green17 = Colors::values[16];
+            inline static constexpr const Color& Green18 = Colors::values[17];
+            inline static constexpr const Color& Green19 = Colors::values[18];
+            inline static constexpr const Color& Green20 = Colors::values[19];
+            inline static constexpr const Color& Green21 = Colors::values[20];
+            inline static constexpr const Color& Green22 = Colors::values[21];
+            inline static constexpr const Color& Green23 = Colors::values[22];
+            inline static constexpr const Color& Green24 = Colors::values[23];
+            inline static constexpr const Color& Green25 = Colors::values[24];
+            inline static constexpr const Color& Green26 = Colors::values[25];
+            inline static constexpr const Color& Green27 = Colors::values[26];
+            inline static constexpr const Color& Green28 = Colors::values[27];
+            inline static constexpr const Color& Green29 = Colors::values[28];
+            inline static constexpr const Color& Green30 = Colors::values[29];
+            inline static constexpr const Color& Green31 = Colors::values[30];
+            inline static constexpr const Color& Green32 = Colors::values[31];
+            inline static constexpr const Color& Green33 = Colors::values[32];
+            inline static constexpr const Color& Green34 = Colors::values[33];
+            inline static constexpr const Color& Green35 = Colors::values[34];
+            inline static constexpr const Color& Green36 = Colors::values[35];
+            inline static constexpr const Color& Green37 = Colors::values[36];
+            inline static constexpr const Color& Green38 = Colors::values[37];
+            inline static constexpr const Color& Green39 = Colors::values[38];
+            inline static constexpr const Color& Green40 = Colors::values[39];
+            inline static constexpr const Color& Green41 = Colors::values[40];
+            inline static constexpr const Color& Green42 = Colors::values[41];
+            inline static constexpr const Color& Green43 = Colors::values[42];
+            inline static constexpr const Color& Green44 = Colors::values[43];
+            inline static constexpr const Color& Green45 = Colors::values[44];
+            inline static constexpr const Color& Green46 = Colors::values[45];
+            inline static constexpr const Color& Green47 = Colors::values[46];
+            inline static constexpr const Color& Green48 = Colors::values[47];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Green              {GREEN::Green2, BgColor};
+            inline static constexpr Color std_Bright_Green       {GREEN::Green10, BgColor};
+            inline static constexpr Color Dark_Green             {GREEN::Green22, BgColor};
+            inline static constexpr Color Medium_Green           {GREEN::Green28, BgColor};
+            inline static constexpr Color Deep_Sea_Green         {GREEN::Green29, BgColor};
+            inline static constexpr Color Spring_Green           {GREEN::Green34, BgColor};
+            inline static constexpr Color Jade_Green             {GREEN::Green35, BgColor};
+            inline static constexpr Color Lime_Green             {GREEN::Green40, BgColor};
+            inline static constexpr Color Light_Spring_Green     {GREEN::Green41, BgColor};
+            inline static constexpr Color Caribbean_Green        {GREEN::Green42, BgColor};
+            inline static constexpr Color Pure_Green             {GREEN::Green46, BgColor};
+            inline static constexpr Color Vibrant_Spring_Green   {GREEN::Green47, BgColor};
+            inline static constexpr Color Soft_Spring_Green      {GREEN::Green48, BgColor};
+            inline static constexpr Color Brilliant_Spring_Green {GREEN::Green49, BgColor};
+            inline static constexpr Color Dark_Olive_Green       {GREEN::Green58, BgColor};
+            inline static constexpr Color Olive_Green            {GREEN::Green64, BgColor};
+            inline static constexpr Color Glade_Green            {GREEN::Green65, BgColor};
+            inline static constexpr Color Kelly_Green            {GREEN::Green70, BgColor};
+            inline static constexpr Color Dark_Sea_Green         {GREEN::Green71, BgColor};
+            inline static constexpr Color Cadet_Green            {GREEN::Green72, BgColor};
+            inline static constexpr Color Strong_Green           {GREEN::Green76, BgColor};
+            inline static constexpr Color Moderate_Lime_Green    {GREEN::Green77, BgColor};
+            inline static constexpr Color Sea_Green              {GREEN::Green78, BgColor};
+            inline static constexpr Color Chartreuse             {GREEN::Green82, BgColor};
+            inline static constexpr Color Light_Lime_Green       {GREEN::Green83, BgColor};
+            inline static constexpr Color Light_Sea_Green        {GREEN::Green84, BgColor};
+            inline static constexpr Color Luminous_Spring_Green  {GREEN::Green85, BgColor};
+            inline static constexpr Color Clay_Creek_Green       {GREEN::Green101, BgColor};
+            inline static constexpr Color Apple_Green            {GREEN::Green106, BgColor};
+            inline static constexpr Color Asparagus_Green        {GREEN::Green107, BgColor};
+            inline static constexpr Color Moss_Green             {GREEN::Green108, BgColor};
+            inline static constexpr Color Pistachio_Green        {GREEN::Green112, BgColor};
+            inline static constexpr Color Mantis_Green           {GREEN::Green113, BgColor};
+            inline static constexpr Color Pale_Green             {GREEN::Green114, BgColor};
+            inline static constexpr Color Bright_Chartreuse      {GREEN::Green118, BgColor};
+            inline static constexpr Color Light_Green            {GREEN::Green119, BgColor};
+            inline static constexpr Color Soft_Green             {GREEN::Green120, BgColor};
+            inline static constexpr Color Mint_Green             {GREEN::Green121, BgColor};
+            inline static constexpr Color Green_Yellow           {GREEN::Green148, BgColor};
+            inline static constexpr Color June_Bud_Green         {GREEN::Green149, BgColor};
+            inline static constexpr Color Pastel_Lime            {GREEN::Green150, BgColor};
+            inline static constexpr Color Grayish_Lime_Green     {GREEN::Green151, BgColor};
+            inline static constexpr Color Spring_Bud_Green       {GREEN::Green154, BgColor};
+            inline static constexpr Color Pastel_Sea_Green       {GREEN::Green155, BgColor};
+            inline static constexpr Color Seafoam_Green          {GREEN::Green156, BgColor};
+            inline static constexpr Color Caladon_Green          {GREEN::Green157, BgColor};
+            inline static constexpr Color Tea_Green              {GREEN::Green193, BgColor};
+            inline static constexpr Color Pastel_Green           {GREEN::Green194, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_Green; }
+    };
+
+    /// @brief The data of the Blue palettes: the Blue range (`operator->()`) and the uniquely named Blue colors.
+    struct Blue_Palette {
+        typedef Defined_Colors::Blue BLUE;
+        inline static constexpr const char* group = "PrimaryColors";
+        inline static constexpr const char* name = "Blue";
+        inline static constexpr const char* short_name = "B";
+
+        /// @brief The color codes of the range (Blue1 - Blue34), sorted from dark to light.
+        inline static constexpr BLUE range[] = {
+            BLUE::Blue17, BLUE::Blue18, BLUE::Blue19, BLUE::Blue20, BLUE::Blue4, BLUE::Blue21,
+            BLUE::Blue25, BLUE::Blue26, BLUE::Blue27, BLUE::Blue60, BLUE::Blue61, BLUE::Blue62,
+            BLUE::Blue63, BLUE::Blue32, BLUE::Blue12, BLUE::Blue33, BLUE::Blue67, BLUE::Blue68,
+            BLUE::Blue69, BLUE::Blue103, BLUE::Blue38, BLUE::Blue104, BLUE::Blue39, BLUE::Blue105,
+            BLUE::Blue74, BLUE::Blue75, BLUE::Blue110, BLUE::Blue45, BLUE::Blue111, BLUE::Blue146,
+            BLUE::Blue147, BLUE::Blue81, BLUE::Blue153, BLUE::Blue189
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Blue_Palette, BgColor> Colors;
+            inline static constexpr const Color& Blue1  = Colors::values[0];
+            inline static constexpr const Color& Blue2  = Colors::values[1];
+            inline static constexpr const Color& Blue3  = Colors::values[2];
+            inline static constexpr const Color& Blue4  = Colors::values[3];
+            inline static constexpr const Color& Blue5  = Colors::values[4];
+            inline static constexpr const Color& Blue6  = Colors::values[5];
+            inline static constexpr const Color& Blue7  = Colors::values[6];
+            inline static constexpr const Color& Blue8  = Colors::values[7];
+            inline static constexpr const Color& Blue9  = Colors::values[8];
+            inline static constexpr const Color& Blue10 = Colors::values[9];
+            inline static constexpr const Color& Blue11 = Colors::values[10];
+            inline static constexpr const Color& Blue12 = Colors::values[11];
+            inline static constexpr const Color& Blue13 = Colors::values[12];
+            inline static constexpr const Color& Blue14 = Colors::values[13];
+            inline static constexpr const Color& Blue15 = Colors::values[14];
+            inline static constexpr const Color& Blue16 = Colors::values[15];
+            inline static constexpr const Color& Blue17 = Colors::values[16];
+            inline static constexpr const Color& Blue18 = Colors::values[17];
+            inline static constexpr const Color& Blue19 = Colors::values[18];
+            inline static constexpr const Color& Blue20 = Colors::values[19];
+            inline static constexpr const Color& Blue21 = Colors::values[20];
+            inline static constexpr const Color& Blue22 = Colors::values[21];
+            inline static constexpr const Color& Blue23 = Colors::values[22];
+            inline static constexpr const Color& Blue24 = Colors::values[23];
+            inline static constexpr const Color& Blue25 = Colors::values[24];
+            inline static constexpr const Color& Blue26 = Colors::values[25];
+            inline static constexpr const Color& Blue27 = Colors::values[26];
+            inline static constexpr const Color& Blue28 = Colors::values[27];
+            inline static constexpr const Color& Blue29 = Colors::values[28];
+            inline static constexpr const Color& Blue30 = Colors::values[29];
+            inline static constexpr const Color& Blue31 = Colors::values[30];
+            inline static constexpr const Color& Blue32 = Colors::values[31];
+            inline static constexpr const Color& Blue33 = Colors::values[32];
+            inline static constexpr const Color& Blue34 = Colors::values[33];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Blue              {BLUE::Blue4, BgColor};
+            inline static constexpr Color std_Bright_Blue       {BLUE::Blue12, BgColor};
+            inline static constexpr Color Dark_Navy_Blue        {BLUE::Blue17, BgColor};
+            inline static constexpr Color Deep_Navy_Blue        {BLUE::Blue18, BgColor};
+            inline static constexpr Color Navy_Blue             {BLUE::Blue19, BgColor};
+            inline static constexpr Color Dark_Blue             {BLUE::Blue20, BgColor};
+            inline static constexpr Color Deep_Blue             {BLUE::Blue21, BgColor};
+            inline static constexpr Color Deep_Sky_Blue         {BLUE::Blue25, BgColor};
+            inline static constexpr Color Science_Blue          {BLUE::Blue26, BgColor};
+            inline static constexpr Color Pure_Blue             {BLUE::Blue27, BgColor};
+            inline static constexpr Color Ocean_Blue            {BLUE::Blue32, BgColor};
+            inline static constexpr Color Vivid_Blue            {BLUE::Blue33, BgColor};
+            inline static constexpr Color Cerulean_Blue         {BLUE::Blue38, BgColor};
+            inline static constexpr Color Azure_Blue            {BLUE::Blue39, BgColor};
+            inline static constexpr Color Vivid_Sky_Blue        {BLUE::Blue45, BgColor};
+            inline static constexpr Color Misty_Slate_Blue      {BLUE::Blue60, BgColor};
+            inline static constexpr Color Comet_Blue            {BLUE::Blue61, BgColor};
+            inline static constexpr Color Slate_Blue            {BLUE::Blue62, BgColor};
+            inline static constexpr Color Bright_Blue           {BLUE::Blue63, BgColor};
+            inline static constexpr Color Lochmara_Blue         {BLUE::Blue67, BgColor};
+            inline static constexpr Color Steel_Blue            {BLUE::Blue68, BgColor};
+            inline static constexpr Color Light_Slate_Blue      {BLUE::Blue69, BgColor};
+            inline static constexpr Color Aegean_Blue           {BLUE::Blue74, BgColor};
+            inline static constexpr Color Iceberg_Blue          {BLUE::Blue75, BgColor};
+            inline static constexpr Color Dusky_Sky_Blue        {BLUE::Blue81, BgColor};
+            inline static constexpr Color Dusky_Cobalt_Blue     {BLUE::Blue103, BgColor};
+            inline static constexpr Color Soft_Indigo_Blue      {BLUE::Blue104, BgColor};
+            inline static constexpr Color Misty_Cornflower_Blue {BLUE::Blue105, BgColor};
+            inline static constexpr Color Horizon_Blue          {BLUE::Blue110, BgColor};
+            inline static constexpr Color Soft_Sky_Blue         {BLUE::Blue111, BgColor};
+            inline static constexpr Color Light_Pearl_Blue      {BLUE::Blue146, BgColor};
+            inline static constexpr Color Light_Steel_Blue      {BLUE::Blue147, BgColor};
+            inline static constexpr Color Pastel_Blue           {BLUE::Blue153, BgColor};
+            inline static constexpr Color Pale_Blue             {BLUE::Blue189, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_Blue; }
+    };
+
+    /// @brief This class defines the primary colors: Red, Green and Blue.
+    template<bool BgColor>
+    class PrimaryColors {
+        /// @brief Defines the primary color Red in to 2 uniquely named color palettes.
+        typedef Color_Palette<Red_Palette, BgColor> _Red;
+        /// @brief Defines the primary color Green in to 2 uniquely named color palettes.
+        typedef Color_Palette<Green_Palette, BgColor> _Green;
+        /// @brief Defines the primary color Blue in to 2 uniquely named color palettes.
+        typedef Color_Palette<Blue_Palette, BgColor> _Blue;
+
+        /// @brief Shortcut struct for easy access to ANSI 256 color definitions without typing full names.
+        ///        Use 'R' for Red, 'G' for Green, and 'B' for Blue to select the corresponding palette.
+        struct ShortCut {
+            const _Red R;
+            const _Green G;
+            const _Blue B;
+            constexpr ShortCut() noexcept : R(true), G(true), B(true){}
+        };
+        const ShortCut short_cut;
+    public:
+        const _Red Red;
+        const _Green Green;
+        const _Blue Blue;
+
+        constexpr PrimaryColors() noexcept : short_cut(), Red(false), Green(false), Blue(false){}
+
+        /// @brief Overloads the `operator->()` as a shortcut for easy access to the (`ShortCut`) ANSI 256 palettes.
+        ///        Use 'R' for Red, 'G' for Green, and 'B' for Blue instead of their full palette names.
+        /// @return A pointer to the internal `short_cut` instance.
+        constexpr const ShortCut* operator->() const noexcept {
+            return &short_cut;
+        }
+    };
+
+    /// @brief The data of the Cyan palettes: the Cyan range (`operator->()`) and the uniquely named Cyan colors.
+    struct Cyan_Palette {
+        typedef Defined_Colors::Cyan CYAN;
+        inline static constexpr const char* group = "SecondaryColors";
+        inline static constexpr const char* name = "Cyan";
+        inline static constexpr const char* short_name = "C";
+
+        /// @brief The color codes of the range (Cyan1 - Cyan28), sorted from dark to light.
+        inline static constexpr CYAN range[] = {
+            CYAN::Cyan23, CYAN::Cyan24, CYAN::Cyan6, CYAN::Cyan30, CYAN::Cyan31, CYAN::Cyan66,
+            CYAN::Cyan36, CYAN::Cyan37, CYAN::Cyan73, CYAN::Cyan43, CYAN::Cyan109, CYAN::Cyan44,
+            CYAN::Cyan79, CYAN::Cyan14, CYAN::Cyan80, CYAN::Cyan115, CYAN::Cyan50, CYAN::Cyan116,
+            CYAN::Cyan51, CYAN::Cyan117, CYAN::Cyan152, CYAN::Cyan86, CYAN::Cyan87, CYAN::Cyan122,
+            CYAN::Cyan123, CYAN::Cyan158, CYAN::Cyan159, CYAN::Cyan195
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Cyan_Palette, BgColor> Colors;
+            inline static constexpr const Color& Cyan1  = Colors::values[0];
+            inline static constexpr const Color& Cyan2  = Colors::values[1];
+            inline static constexpr const Color& Cyan3  = Colors::values[2];
+            inline static constexpr const Color& Cyan4  = Colors::values[3];
+            inline static constexpr const Color& Cyan5  = Colors::values[4];
+            inline static constexpr const Color& Cyan6  = Colors::values[5];
+            inline static constexpr const Color& Cyan7  = Colors::values[6];
+            inline static constexpr const Color& Cyan8  = Colors::values[7];
+            inline static constexpr const Color& Cyan9  = Colors::values[8];
+            inline static constexpr const Color& Cyan10 = Colors::values[9];
+            inline static constexpr const Color& Cyan11 = Colors::values[10];
+            inline static constexpr const Color& Cyan12 = Colors::values[11];
+            inline static constexpr const Color& Cyan13 = Colors::values[12];
+            inline static constexpr const Color& Cyan14 = Colors::values[13];
+            inline static constexpr const Color& Cyan15 = Colors::values[14];
+            inline static constexpr const Color& Cyan16 = Colors::values[15];
+            inline static constexpr const Color& Cyan17 = Colors::values[16];
+            inline static constexpr const Color& Cyan18 = Colors::values[17];
+            inline static constexpr const Color& Cyan19 = Colors::values[18];
+            inline static constexpr const Color& Cyan20 = Colors::values[19];
+            inline static constexpr const Color& Cyan21 = Colors::values[20];
+            inline static constexpr const Color& Cyan22 = Colors::values[21];
+            inline static constexpr const Color& Cyan23 = Colors::values[22];
+            inline static constexpr const Color& Cyan24 = Colors::values[23];
+            inline static constexpr const Color& Cyan25 = Colors::values[24];
+            inline static constexpr const Color& Cyan26 = Colors::values[25];
+            inline static constexpr const Color& Cyan27 = Colors::values[26];
+            inline static constexpr const Color& Cyan28 = Colors::values[27];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Cyan          {CYAN::Cyan6, BgColor};
+            inline static constexpr Color std_Bright_Cyan   {CYAN::Cyan14, BgColor};
+            inline static constexpr Color Dark_Cyan         {CYAN::Cyan23, BgColor};
+            inline static constexpr Color Deep_Cyan         {CYAN::Cyan24, BgColor};
+            inline static constexpr Color Dark_Turquoise    {CYAN::Cyan30, BgColor};
+            inline static constexpr Color Medium_Turquoise  {CYAN::Cyan31, BgColor};
+            inline static constexpr Color Rich_Cyan         {CYAN::Cyan36, BgColor};
+            inline static constexpr Color Tiffany_Cyan      {CYAN::Cyan37, BgColor};
+            inline static constexpr Color Lagoon_Cyan       {CYAN::Cyan43, BgColor};
+            inline static constexpr Color Vibrant_Turquoise {CYAN::Cyan44, BgColor};
+            inline static constexpr Color Pure_Cyan         {CYAN::Cyan50, BgColor};
+            inline static constexpr Color Aqua_Cyan         {CYAN::Cyan51, BgColor};
+            inline static constexpr Color Juniper_Cyan      {CYAN::Cyan66, BgColor};
+            inline static constexpr Color Harbor_Cyan       {CYAN::Cyan73, BgColor};
+            inline static constexpr Color Myrtle_Cyan       {CYAN::Cyan79, BgColor};
+            inline static constexpr Color Tidewater_Cyan    {CYAN::Cyan80, BgColor};
+            inline static constexpr Color Reef_Cyan         {CYAN::Cyan86, BgColor};
+            inline static constexpr Color Frost_Cyan        {CYAN::Cyan87, BgColor};
+            inline static constexpr Color Pewter_Cyan       {CYAN::Cyan109, BgColor};
+            inline static constexpr Color Sage_Cyan         {CYAN::Cyan115, BgColor};
+            inline static constexpr Color Bermuda_Cyan      {CYAN::Cyan116, BgColor};
+            inline static constexpr Color Morning_Mist_Cyan {CYAN::Cyan117, BgColor};
+            inline static constexpr Color Aquamarine_Cyan   {CYAN::Cyan122, BgColor};
+            inline static constexpr Color Opal_Cyan         {CYAN::Cyan123, BgColor};
+            inline static constexpr Color Shallows_Cyan     {CYAN::Cyan152, BgColor};
+            inline static constexpr Color Algae_Cyan        {CYAN::Cyan158, BgColor};
+            inline static constexpr Color Glacier_Cyan      {CYAN::Cyan159, BgColor};
+            inline static constexpr Color Ebb_Tide_Cyan     {CYAN::Cyan195, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_Cyan; }
+    };
+
+    /// @brief The data of the Yellow palettes: the Yellow range (`operator->()`) and the uniquely named Yellow colors.
+    struct Yellow_Palette {
+        typedef Defined_Colors::Yellow YELLOW;
+        inline static constexpr const char* group = "SecondaryColors";
+        inline static constexpr const char* name = "Yellow";
+        inline static constexpr const char* short_name = "Y";
+
+        /// @brief The color codes of the range (Yellow1 - Yellow22), sorted from dark to light.
+        inline static constexpr YELLOW range[] = {
+            YELLOW::Yellow100, YELLOW::Yellow3, YELLOW::Yellow142, YELLOW::Yellow143, YELLOW::Yellow178, YELLOW::Yellow144,
+            YELLOW::Yellow184, YELLOW::Yellow185, YELLOW::Yellow220, YELLOW::Yellow186, YELLOW::Yellow187, YELLOW::Yellow221,
+            YELLOW::Yellow222, YELLOW::Yellow190, YELLOW::Yellow191, YELLOW::Yellow11, YELLOW::Yellow226, YELLOW::Yellow192,
+            YELLOW::Yellow227, YELLOW::Yellow228, YELLOW::Yellow229, YELLOW::Yellow230
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Yellow_Palette, BgColor> Colors;
+            inline static constexpr const Color& Yellow1  = Colors::values[0];
+            inline static constexpr const Color& Yellow2  = Colors::values[1];
+            inline static constexpr const Color& Yellow3  = Colors::values[2];
+            inline static constexpr const Color& Yellow4  = Colors::values[3];
+            inline static constexpr const Color& Yellow5  = Colors::values[4];
+            inline static constexpr const Color& Yellow6  = Colors::values[5];
+            inline static constexpr const Color& Yellow7  = Colors::values[6];
+            inline static constexpr const Color& Yellow8  = Colors::values[7];
+            inline static constexpr const Color& Yellow9  = Colors::values[8];
+            inline static constexpr const Color& Yellow10 = Colors::values[9];
+            inline static constexpr const Color& Yellow11 = Colors::values[10];
+            inline static constexpr const Color& Yellow12 = Colors::values[11];
+            inline static constexpr const Color& Yellow13 = Colors::values[12];
+            inline static constexpr const Color& Yellow14 = Colors::values[13];
+            inline static constexpr const Color& Yellow15 = Colors::values[14];
+            inline static constexpr const Color& Yellow16 = Colors::values[15];
+            inline static constexpr const Color& Yellow17 = Colors::values[16];
+            inline static constexpr const Color& Yellow18 = Colors::values[17];
+            inline static constexpr const Color& Yellow19 = Colors::values[18];
+            inline static constexpr const Color& Yellow20 = Colors::values[19];
+            inline static constexpr const Color& Yellow21 = Colors::values[20];
+            inline static constexpr const Color& Yellow22 = Colors::values[21];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Yellow        {YELLOW::Yellow3, BgColor};
+            inline static constexpr Color std_Bright_Yellow {YELLOW::Yellow11, BgColor};
+            inline static constexpr Color Mustard_Yellow    {YELLOW::Yellow100, BgColor};
+            inline static constexpr Color Light_Gold        {YELLOW::Yellow142, BgColor};
+            inline static constexpr Color Dark_Khaki        {YELLOW::Yellow143, BgColor};
+            inline static constexpr Color Light_Khaki       {YELLOW::Yellow144, BgColor};
+            inline static constexpr Color Deep_Yellow       {YELLOW::Yellow178, BgColor};
+            inline static constexpr Color Strong_Yellow     {YELLOW::Yellow184, BgColor};
+            inline static constexpr Color Mellow_Yellow     {YELLOW::Yellow185, BgColor};
+            inline static constexpr Color Muted_Yellow      {YELLOW::Yellow186, BgColor};
+            inline static constexpr Color Soft_Yellow       {YELLOW::Yellow187, BgColor};
+            inline static constexpr Color Neon_Yellow       {YELLOW::Yellow190, BgColor};
+            inline static constexpr Color Bright_Lemon      {YELLOW::Yellow191, BgColor};
+            inline static constexpr Color Lemon_Lime        {YELLOW::Yellow192, BgColor};
+            inline static constexpr Color Amber             {YELLOW::Yellow220, BgColor};
+            inline static constexpr Color Honey_Yellow      {YELLOW::Yellow221, BgColor};
+            inline static constexpr Color Marigold_Yellow   {YELLOW::Yellow222, BgColor};
+            inline static constexpr Color Pure_Yellow       {YELLOW::Yellow226, BgColor};
+            inline static constexpr Color Golden_Yellow     {YELLOW::Yellow227, BgColor};
+            inline static constexpr Color Pastel_Yellow     {YELLOW::Yellow228, BgColor};
+            inline static constexpr Color Light_Yellow      {YELLOW::Yellow229, BgColor};
+            inline static constexpr Color Pale_Yellow       {YELLOW::Yellow230, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_Yellow; }
+    };
+
+    /// @brief The data of the Purple palettes: the Purple range (`operator->()`) and the uniquely named Purple colors.
+    struct Purple_Palette {
+        typedef Defined_Colors::Purple PURPLE;
+        inline static constexpr const char* group = "SecondaryColors";
+        inline static constexpr const char* name = "Purple";
+        inline static constexpr const char* short_name = "P";
+
+        /// @brief The color codes of the range (Purple1 - Purple22), sorted from dark to light.
+        inline static constexpr PURPLE range[] = {
+            PURPLE::Purple53, PURPLE::Purple90, PURPLE::Purple5, PURPLE::Purple91, PURPLE::Purple126, PURPLE::Purple127,
+            PURPLE::Purple128, PURPLE::Purple129, PURPLE::Purple164, PURPLE::Purple165, PURPLE::Purple201, PURPLE::Purple96,
+            PURPLE::Purple133, PURPLE::Purple134, PURPLE::Purple170, PURPLE::Purple171, PURPLE::Purple207, PURPLE::Purple139,
+            PURPLE::Purple176, PURPLE::Purple213, PURPLE::Purple219, PURPLE::Purple225
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Purple_Palette, BgColor> Colors;
+            inline static constexpr const Color& Purple1  = Colors::values[0];
+            inline static constexpr const Color& Purple2  = Colors::values[1];
+            inline static constexpr const Color& Purple3  = Colors::values[2];
+            inline static constexpr const Color& Purple4  = Colors::values[3];
+            inline static constexpr const Color& Purple5  = Colors::values[4];
+            inline static constexpr const Color& Purple6  = Colors::values[5];
+            inline static constexpr const Color& Purple7  = Colors::values[6];
+            inline static constexpr const Color& Purple8  = Colors::values[7];
+            inline static constexpr const Color& Purple9  = Colors::values[8];
+            inline static constexpr const Color& Purple10 = Colors::values[9];
+            inline static constexpr const Color& Purple11 = Colors::values[10];
+            inline static constexpr const Color& Purple12 = Colors::values[11];
+            inline static constexpr const Color& Purple13 = Colors::values[12];
+            inline static constexpr const Color& Purple14 = Colors::values[13];
+            inline static constexpr const Color& Purple15 = Colors::values[14];
+            inline static constexpr const Color& Purple16 = Colors::values[15];
+            inline static constexpr const Color& Purple17 = Colors::values[16];
+            inline static constexpr const Color& Purple18 = Colors::values[17];
+            inline static constexpr const Color& Purple19 = Colors::values[18];
+            inline static constexpr const Color& Purple20 = Colors::values[19];
+            inline static constexpr const Color& Purple21 = Colors::values[20];
+            inline static constexpr const Color& Purple22 = Colors::values[21];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Purple              {PURPLE::Purple5, BgColor};
+            inline static constexpr Color Imperial_Purple         {PURPLE::Purple53, BgColor};
+            inline static constexpr Color Velvet_Plum_Purple      {PURPLE::Purple90, BgColor};
+            inline static constexpr Color Mystic_Amethyst_Purple  {PURPLE::Purple91, BgColor};
+            inline static constexpr Color Smokey_Orchid_Purple    {PURPLE::Purple96, BgColor};
+            inline static constexpr Color Velvet_Magenta_Purple   {PURPLE::Purple126, BgColor};
+            inline static constexpr Color Heliotrope_Purple       {PURPLE::Purple127, BgColor};
+            inline static constexpr Color Orchid_Purple           {PURPLE::Purple128, BgColor};
+            inline static constexpr Color Fuchsia_Purple          {PURPLE::Purple129, BgColor};
+            inline static constexpr Color Lilac_Purple            {PURPLE::Purple133, BgColor};
+            inline static constexpr Color Heather_Purple          {PURPLE::Purple134, BgColor};
+            inline static constexpr Color Mauve_Purple            {PURPLE::Purple139, BgColor};
+            inline static constexpr Color Electric_Fuchsia_Purple {PURPLE::Purple164, BgColor};
+            inline static constexpr Color Orchid_Magenta_Purple   {PURPLE::Purple165, BgColor};
+            inline static constexpr Color Light_Magenta_Purple    {PURPLE::Purple170, BgColor};
+            inline static constexpr Color Haze_Purple             {PURPLE::Purple171, BgColor};
+            inline static constexpr Color Pastel_Orchid_Purple    {PURPLE::Purple176, BgColor};
+            inline static constexpr Color Radiant_Amethyst_Purple {PURPLE::Purple201, BgColor};
+            inline static constexpr Color Pastel_Fuchsia_Purple   {PURPLE::Purple207, BgColor};
+            inline static constexpr Color Cotton_Candy_Purple     {PURPLE::Purple213, BgColor};
+            inline static constexpr Color Pastel_Plum_Purple      {PURPLE::Purple219, BgColor};
+            inline static constexpr Color Pale_Lilac_Purple       {PURPLE::Purple225, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Fuchsia_Purple; }
+    };
+
+    /// @brief This class defines the secondary colors: Cyan, Yellow and Purple.
+    template<bool BgColor>
+    class SecondaryColors {
+        /// @brief Defines the secondary color Cyan in to 2 uniquely named color palettes.
+        typedef Color_Palette<Cyan_Palette, BgColor> _Cyan;
+        /// @brief Defines the Secondary color Yellow in to 2 uniquely named color palettes.
+        typedef Color_Palette<Yellow_Palette, BgColor> _Yellow;
+        /// @brief Defines the secondary color Purple in to 2 uniquely named color palettes.
+        typedef Color_Palette<Purple_Palette, BgColor> _Purple;
+
+        /// @brief Shortcut struct for easy access to ANSI 256 color definitions without typing full names.
+        ///        Use 'C' for Cyan, 'Y' for Yellow, and 'P' for Purple to select the corresponding palette.
+        struct ShortCut {
+            const _Cyan C;
+            const _Yellow Y;
+            const _Purple P;
+            constexpr ShortCut() noexcept : C(true), Y(true), P(true){}
+        };
+        const ShortCut short_cut;
+    public:
+        const _Cyan Cyan;
+        const _Yellow Yellow;
+        const _Purple Purple;
+
+        constexpr SecondaryColors() noexcept : short_cut(), Cyan(false), Yellow(false), Purple(false){}
+
+        /// @brief Overloads the `operator->()` as a shortcut for easy access to the (`ShortCut`) ANSI 256 palettes.
+        ///        Use 'C' for Cyan, 'Y' for Yellow, and 'P' for Purple instead of their full palette names.
+        /// @return A pointer to the internal `short_cut` instance.
+        constexpr const ShortCut* operator->() const noexcept {
+            return &short_cut;
+        }
+    };
+
+    /// @brief The data of the Orange palettes: the Orange range (`operator->()`) and the uniquely named Orange colors.
+    struct Orange_Palette {
+        typedef Defined_Colors::Orange ORANGE;
+        inline static constexpr const char* group = "TertiaryColors";
+        inline static constexpr const char* name = "Orange";
+        inline static constexpr const char* short_name = "O";
+
+        /// @brief The color codes of the range (Orange1 - Orange9), sorted from dark to light.
+        inline static constexpr ORANGE range[] = {
+            ORANGE::Orange130, ORANGE::Orange166, ORANGE::Orange202, ORANGE::Orange172, ORANGE::Orange208, ORANGE::Orange209,
+            ORANGE::Orange214, ORANGE::Orange215, ORANGE::Orange216
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Orange_Palette, BgColor> Colors;
+            inline static constexpr const Color& Orange1 = Colors::values[0];
+            inline static constexpr const Color& Orange2 = Colors::values[1];
+            inline static constexpr const Color& Orange3 = Colors::values[2];
+            inline static constexpr const Color& Orange4 = Colors::values[3];
+            inline static constexpr const Color& Orange5 = Colors::values[4];
+            inline static constexpr const Color& Orange6 = Colors::values[5];
+            inline static constexpr const Color& Orange7 = Colors::values[6];
+            inline static constexpr const Color& Orange8 = Colors::values[7];
+            inline static constexpr const Color& Orange9 = Colors::values[8];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color Dark_Orange         {ORANGE::Orange130, BgColor};
+            inline static constexpr Color Strong_Orange       {ORANGE::Orange166, BgColor};
+            inline static constexpr Color Burnt_Orange        {ORANGE::Orange172, BgColor};
+            inline static constexpr Color Pure_Orange         {ORANGE::Orange202, BgColor};
+            inline static constexpr Color Amber               {ORANGE::Orange208, BgColor};
+            inline static constexpr Color Coral_Orange        {ORANGE::Orange209, BgColor};
+            inline static constexpr Color Golden_Orange       {ORANGE::Orange214, BgColor};
+            inline static constexpr Color Sandy_Orange        {ORANGE::Orange215, BgColor};
+            inline static constexpr Color Light_Salmon_Orange {ORANGE::Orange216, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_Orange; }
+    };
+
+    /// @brief The data of the Brown palettes: the Brown range (`operator->()`) and the uniquely named Brown colors.
+    struct Brown_Palette {
+        typedef Defined_Colors::Brown BROWN;
+        inline static constexpr const char* group = "TertiaryColors";
+        inline static constexpr const char* name = "Brown";
+        inline static constexpr const char* short_name = "B";
+
+        /// @brief The color codes of the range (Brown1 - Brown11), sorted from dark to light.
+        inline static constexpr BROWN range[] = {
+            BROWN::Brown94, BROWN::Brown95, BROWN::Brown131, BROWN::Brown136, BROWN::Brown137, BROWN::Brown138,
+            BROWN::Brown173, BROWN::Brown179, BROWN::Brown180, BROWN::Brown181, BROWN::Brown223
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Brown_Palette, BgColor> Colors;
+            inline static constexpr const Color& Brown1  = Colors::values[0];
+            inline static constexpr const Color& Brown2  = Colors::values[1];
+            inline static constexpr const Color& Brown3  = Colors::values[2];
+            inline static constexpr const Color& Brown4  = Colors::values[3];
+            inline static constexpr const Color& Brown5  = Colors::values[4];
+            inline static constexpr const Color& Brown6  = Colors::values[5];
+            inline static constexpr const Color& Brown7  = Colors::values[6];
+            inline static constexpr const Color& Brown8  = Colors::values[7];
+            inline static constexpr const Color& Brown9  = Colors::values[8];
+            inline static constexpr const Color& Brown10 = Colors::values[9];
+            inline static constexpr const Color& Brown11 = Colors::values[10];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color Russet_Brown          {BROWN::Brown94, BgColor};
+            inline static constexpr Color Brick_Rose_Brown      {BROWN::Brown95, BgColor};
+            inline static constexpr Color Chestnut_Brown        {BROWN::Brown131, BgColor};
+            inline static constexpr Color Dark_Goldenrod_Brown  {BROWN::Brown136, BgColor};
+            inline static constexpr Color Desert_Sand_Brown     {BROWN::Brown137, BgColor};
+            inline static constexpr Color Dusty_Taupe_Brown     {BROWN::Brown138, BgColor};
+            inline static constexpr Color Copperfield_Brown     {BROWN::Brown173, BgColor};
+            inline static constexpr Color Sandstone_Brown       {BROWN::Brown179, BgColor};
+            inline static constexpr Color Light_Sandstone_Brown {BROWN::Brown180, BgColor};
+            inline static constexpr Color Pale_Chestnut_Brown   {BROWN::Brown181, BgColor};
+            inline static constexpr Color Pastel_Moccasin_Brown {BROWN::Brown223, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Russet_Brown; }
+    };
+
+    /// @brief The data of the Violet palettes: the Violet range (`operator->()`) and the uniquely named Violet colors.
+    struct Violet_Palette {
+        typedef Defined_Colors::Violet VIOLET;
+        inline static constexpr const char* group = "TertiaryColors";
+        inline static constexpr const char* name = "Violet";
+        inline static constexpr const char* short_name = "V";
+
+        /// @brief The color codes of the range (Violet1 - Violet15), sorted from dark to light.
+        inline static constexpr VIOLET range[] = {
+            VIOLET::Violet54, VIOLET::Violet55, VIOLET::Violet56, VIOLET::Violet57, VIOLET::Violet92, VIOLET::Violet93,
+            VIOLET::Violet97, VIOLET::Violet98, VIOLET::Violet99, VIOLET::Violet135, VIOLET::Violet140, VIOLET::Violet141,
+            VIOLET::Violet177, VIOLET::Violet182, VIOLET::Violet183
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Violet_Palette, BgColor> Colors;
+            inline static constexpr const Color& Violet1  = Colors::values[0];
+            inline static constexpr const Color& Violet2  = Colors::values[1];
+            inline static constexpr const Color& Violet3  = Colors::values[2];
+            inline static constexpr const Color& Violet4  = Colors::values[3];
+            inline static constexpr const Color& Violet5  = Colors::values[4];
+            inline static constexpr const Color& Violet6  = Colors::values[5];
+            inline static constexpr const Color& Violet7  = Colors::values[6];
+            inline static constexpr const Color& Violet8  = Colors::values[7];
+            inline static constexpr const Color& Violet9  = Colors::values[8];
+            inline static constexpr const Color& Violet10 = Colors::values[9];
+            inline static constexpr const Color& Violet11 = Colors::values[10];
+            inline static constexpr const Color& Violet12 = Colors::values[11];
+            inline static constexpr const Color& Violet13 = Colors::values[12];
+            inline static constexpr const Color& Violet14 = Colors::values[13];
+            inline static constexpr const Color& Violet15 = Colors::values[14];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color Deep_Orchid_Violet      {VIOLET::Violet54, BgColor};
+            inline static constexpr Color Amethyst_Violet         {VIOLET::Violet55, BgColor};
+            inline static constexpr Color Orchid_Violet           {VIOLET::Violet56, BgColor};
+            inline static constexpr Color Blue_Violet             {VIOLET::Violet57, BgColor};
+            inline static constexpr Color Strong_Violet           {VIOLET::Violet92, BgColor};
+            inline static constexpr Color Electric_Violet         {VIOLET::Violet93, BgColor};
+            inline static constexpr Color Smokey_Amethyst_Violet  {VIOLET::Violet97, BgColor};
+            inline static constexpr Color Dusty_Lavender_Violet   {VIOLET::Violet98, BgColor};
+            inline static constexpr Color Munstead_Violet         {VIOLET::Violet99, BgColor};
+            inline static constexpr Color Light_Violet            {VIOLET::Violet135, BgColor};
+            inline static constexpr Color Hazy_Lilac_Violet       {VIOLET::Violet140, BgColor};
+            inline static constexpr Color Lavender_Violet         {VIOLET::Violet141, BgColor};
+            inline static constexpr Color Misty_Lavender_Violet   {VIOLET::Violet177, BgColor};
+            inline static constexpr Color Frosted_Lavender_Violet {VIOLET::Violet182, BgColor};
+            inline static constexpr Color Pearl_Violet            {VIOLET::Violet183, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Blue_Violet; }
+    };
+
+    /// @brief The data of the Pink palettes: the Pink range (`operator->()`) and the uniquely named Pink colors.
+    struct Pink_Palette {
+        typedef Defined_Colors::Pink PINK;
+        inline static constexpr const char* group = "TertiaryColors";
+        inline static constexpr const char* name = "Pink";
+        inline static constexpr const char* short_name = "P";
+
+        /// @brief The color codes of the range (Pink1 - Pink22), sorted from dark to light.
+        inline static constexpr PINK range[] = {
+            PINK::Pink89, PINK::Pink125, PINK::Pink13, PINK::Pink161, PINK::Pink162, PINK::Pink163,
+            PINK::Pink197, PINK::Pink198, PINK::Pink199, PINK::Pink200, PINK::Pink132, PINK::Pink168,
+            PINK::Pink169, PINK::Pink204, PINK::Pink205, PINK::Pink206, PINK::Pink174, PINK::Pink175,
+            PINK::Pink211, PINK::Pink212, PINK::Pink218, PINK::Pink224
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Pink_Palette, BgColor> Colors;
+            inline static constexpr const Color& Pink1  = Colors::values[0];
+            inline static constexpr const Color& Pink2  = Colors::values[1];
+            inline static constexpr const Color& Pink3  = Colors::values[2];
+            inline static constexpr const Color& Pink4  = Colors::values[3];
+            inline static constexpr const Color& Pink5  = Colors::values[4];
+            inline static constexpr const Color& Pink6  = Colors::values[5];
+            inline static constexpr const Color& Pink7  = Colors::values[6];
+            inline static constexpr const Color& Pink8  = Colors::values[7];
+            inline static constexpr const Color& Pink9  = Colors::values[8];
+            inline static constexpr const Color& Pink10 = Colors::values[9];
+            inline static constexpr const Color& Pink11 = Colors::values[10];
+            inline static constexpr const Color& Pink12 = Colors::values[11];
+            inline static constexpr const Color& Pink13 = Colors::values[12];
+            inline static constexpr const Color& Pink14 = Colors::values[13];
+            inline static constexpr const Color& Pink15 = Colors::values[14];
+            inline static constexpr const Color& Pink16 = Colors::values[15];
+            inline static constexpr const Color& Pink17 = Colors::values[16];
+            inline static constexpr const Color& Pink18 = Colors::values[17];
+            inline static constexpr const Color& Pink19 = Colors::values[18];
+            inline static constexpr const Color& Pink20 = Colors::values[19];
+            inline static constexpr const Color& Pink21 = Colors::values[20];
+            inline static constexpr const Color& Pink22 = Colors::values[21];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Pink              {PINK::Pink13, BgColor};
+            inline static constexpr Color Dark_Pink             {PINK::Pink89, BgColor};
+            inline static constexpr Color Raspberry_Rose_Pink   {PINK::Pink125, BgColor};
+            inline static constexpr Color Peony_Pink            {PINK::Pink132, BgColor};
+            inline static constexpr Color Vivid_Pink            {PINK::Pink161, BgColor};
+            inline static constexpr Color Deep_Fuchsia_Pink     {PINK::Pink162, BgColor};
+            inline static constexpr Color Fuchsia_Pink          {PINK::Pink163, BgColor};
+            inline static constexpr Color Rosebud_Pink          {PINK::Pink168, BgColor};
+            inline static constexpr Color Dreamy_Raspberry_Pink {PINK::Pink169, BgColor};
+            inline static constexpr Color Blush_Rose_Pink       {PINK::Pink174, BgColor};
+            inline static constexpr Color Rose_Quartz_Pink      {PINK::Pink175, BgColor};
+            inline static constexpr Color Vivid_Raspberry_Pink  {PINK::Pink197, BgColor};
+            inline static constexpr Color Neon_Rose_Pink        {PINK::Pink198, BgColor};
+            inline static constexpr Color Dragonfruit_Pink      {PINK::Pink199, BgColor};
+            inline static constexpr Color Electric_Magenta_Pink {PINK::Pink200, BgColor};
+            inline static constexpr Color Watermelon_Candy_Pink {PINK::Pink204, BgColor};
+            inline static constexpr Color Cherry_Blossom_Pink   {PINK::Pink205, BgColor};
+            inline static constexpr Color Silk_Rose_Pink        {PINK::Pink206, BgColor};
+            inline static constexpr Color Tickle_Me_Pink        {PINK::Pink211, BgColor};
+            inline static constexpr Color Princess_Perfume_Pink {PINK::Pink212, BgColor};
+            inline static constexpr Color Rosewater_Pink        {PINK::Pink218, BgColor};
+            inline static constexpr Color Powder_Pink           {PINK::Pink224, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Neon_Rose_Pink; }
+    };
+
+    /// @brief This class defines the Tertiary colors ('catch all' for all colors that are not primary- or secondary colors): Orange, Brown, Violet and Pink.
+    template<bool BgColor>
+    class TertiaryColors {
+        /// @brief Defines the Tertiary color Orange in to 2 uniquely named color palettes.
+        typedef Color_Palette<Orange_Palette, BgColor> _Orange;
+        /// @brief Defines the Tertiary color Brown in to 2 uniquely named color palettes.
+        typedef Color_Palette<Brown_Palette, BgColor> _Brown;
+        /// @brief Defines the Tertiary color Violet in to 2 uniquely named color palettes.
+        typedef Color_Palette<Violet_Palette, BgColor> _Violet;
+        /// @brief Defines the Tertiary color Pink in to 2 uniquely named color palettes.
+        typedef Color_Palette<Pink_Palette, BgColor> _Pink;
+
+        /// @brief Shortcut struct for easy access to ANSI 256 color definitions without typing full names.
+        ///        Use 'O' for Orange, 'B' for Brown, 'V' for Violet, and 'P' for Pink to select the corresponding palette.
+        struct ShortCut {
+            const _Orange O;
+            const _Brown B;
+            const _Violet V;
+            const _Pink P;
+            constexpr ShortCut() noexcept : O(true), B(true), V(true), P(true){}
+        };
+        const ShortCut short_cut;
+    public:
+        const _Orange Orange;
+        const _Brown Brown;
+        const _Violet Violet;
+        const _Pink Pink;
+
+        constexpr TertiaryColors() noexcept : short_cut(), Orange(false), Brown(false), Violet(false), Pink(false){}
+
+        /// @brief Overloads the `operator->()` as a shortcut for easy access to the (`ShortCut`) ANSI 256 palettes.
+        ///        Use 'O' for Orange, 'B' for Brown, 'V' for Violet, and 'P' for Pink instead of their full palette names.
+        /// @return A pointer to the internal `short_cut` instance.
+        constexpr const ShortCut* operator->() const noexcept {
+            return &short_cut;
+        }
+    };
+
+    /// @brief The data of the Black palettes: the Black range (`operator->()`) and the uniquely named Black colors.
+    struct Black_Palette {
+        typedef Defined_Colors::Black BLACK;
+        inline static constexpr const char* group = "GrayScaleColors";
+        inline static constexpr const char* name = "Black";
+        inline static constexpr const char* short_name = "B";
+
+        /// @brief The color codes of the range (Black1 - Black4), sorted from dark to light.
+        inline static constexpr BLACK range[] = {
+            BLACK::Black16, BLACK::Black232, BLACK::Black0, BLACK::Black233
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Black_Palette, BgColor> Colors;
+            inline static constexpr const Color& Black1 = Colors::values[0];
+            inline static constexpr const Color& Black2 = Colors::values[1];
+            inline static constexpr const Color& Black3 = Colors::values[2];
+            inline static constexpr const Color& Black4 = Colors::values[3];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Black        {BLACK::Black0, BgColor};
+            inline static constexpr Color Extended_Black   {BLACK::Black16, BgColor};
+            inline static constexpr Color Vampire_Black    {BLACK::Black232, BgColor};
+            inline static constexpr Color Nightshade_Black {BLACK::Black233, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Extended_Black; }
+    };
+
+    /// @brief The data of the Gray palettes: the Gray range (`operator->()`) and the uniquely named Gray colors.
+    struct Gray_Palette {
+        typedef Defined_Colors::Gray GRAY;
+        inline static constexpr const char* group = "GrayScaleColors";
+        inline static constexpr const char* name = "Gray";
+        inline static constexpr const char* short_name = "G";
+
+        /// @brief The color codes of the range (Gray1 - Gray26), sorted from dark to light.
+        inline static constexpr GRAY range[] = {
+            GRAY::Gray234, GRAY::Gray235, GRAY::Gray236, GRAY::Gray237, GRAY::Gray238, GRAY::Gray239,
+            GRAY::Gray240, GRAY::Gray59, GRAY::Gray241, GRAY::Gray242, GRAY::Gray243, GRAY::Gray8,
+            GRAY::Gray244, GRAY::Gray102, GRAY::Gray245, GRAY::Gray246, GRAY::Gray247, GRAY::Gray248,
+            GRAY::Gray145, GRAY::Gray249, GRAY::Gray250, GRAY::Gray251, GRAY::Gray252, GRAY::Gray188,
+            GRAY::Gray253, GRAY::Gray254
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Gray_Palette, BgColor> Colors;
+            inline static constexpr const Color& Gray1  = Colors::values[0];
+            inline static constexpr const Color& Gray2  = Colors::values[1];
+            inline static constexpr const Color& Gray3  = Colors::values[2];
+            inline static constexpr const Color& Gray4  = Colors::values[3];
+            inline static constexpr const Color& Gray5  = Colors::values[4];
+            inline static constexpr const Color& Gray6  = Colors::values[5];
+            inline static constexpr const Color& Gray7  = Colors::values[6];
+            inline static constexpr const Color& Gray8  = Colors::values[7];
+            inline static constexpr const Color& Gray9  = Colors::values[8];
+            inline static constexpr const Color& Gray10 = Colors::values[9];
+            inline static constexpr const Color& Gray11 = Colors::values[10];
+            inline static constexpr const Color& Gray12 = Colors::values[11];
+            inline static constexpr const Color& Gray13 = Colors::values[12];
+            inline static constexpr const Color& Gray14 = Colors::values[13];
+            inline static constexpr const Color& Gray15 = Colors::values[14];
+            inline static constexpr const Color& Gray16 = Colors::values[15];
+            inline static constexpr const Color& Gray17 = Colors::values[16];
+            inline static constexpr const Color& Gray18 = Colors::values[17];
+            inline static constexpr const Color& Gray19 = Colors::values[18];
+            inline static constexpr const Color& Gray20 = Colors::values[19];
+            inline static constexpr const Color& Gray21 = Colors::values[20];
+            inline static constexpr const Color& Gray22 = Colors::values[21];
+            inline static constexpr const Color& Gray23 = Colors::values[22];
+            inline static constexpr const Color& Gray24 = Colors::values[23];
+            inline static constexpr const Color& Gray25 = Colors::values[24];
+            inline static constexpr const Color& Gray26 = Colors::values[25];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_Gray            {GRAY::Gray8, BgColor};
+            inline static constexpr Color Granite_Gray        {GRAY::Gray59, BgColor};
+            inline static constexpr Color Smoke_Gray          {GRAY::Gray102, BgColor};
+            inline static constexpr Color Fog_Gray            {GRAY::Gray145, BgColor};
+            inline static constexpr Color Frosted_Gray        {GRAY::Gray188, BgColor};
+            inline static constexpr Color Soot_Gray           {GRAY::Gray234, BgColor};
+            inline static constexpr Color Graphite_Gray       {GRAY::Gray235, BgColor};
+            inline static constexpr Color Charcoal_Gray       {GRAY::Gray236, BgColor};
+            inline static constexpr Color Dusty_Charcoal_Gray {GRAY::Gray237, BgColor};
+            inline static constexpr Color Slate_Gray          {GRAY::Gray238, BgColor};
+            inline static constexpr Color Gravel_Gray         {GRAY::Gray239, BgColor};
+            inline static constexpr Color Shadow_Gray         {GRAY::Gray240, BgColor};
+            inline static constexpr Color Nickel_Gray         {GRAY::Gray241, BgColor};
+            inline static constexpr Color Mercury_Gray        {GRAY::Gray242, BgColor};
+            inline static constexpr Color Dove_Gray           {GRAY::Gray243, BgColor};
+            inline static constexpr Color Flint_Gray          {GRAY::Gray244, BgColor};
+            inline static constexpr Color Driftwood_Gray      {GRAY::Gray245, BgColor};
+            inline static constexpr Color Stone_Gray          {GRAY::Gray246, BgColor};
+            inline static constexpr Color Silver_Gray         {GRAY::Gray247, BgColor};
+            inline static constexpr Color Concrete_Gray       {GRAY::Gray248, BgColor};
+            inline static constexpr Color Aluminum_Gray       {GRAY::Gray249, BgColor};
+            inline static constexpr Color Silver_Foil_Gray    {GRAY::Gray250, BgColor};
+            inline static constexpr Color Chalk_Gray          {GRAY::Gray251, BgColor};
+            inline static constexpr Color Marble_Gray         {GRAY::Gray252, BgColor};
+            inline static constexpr Color Porcelain_Gray      {GRAY::Gray253, BgColor};
+            inline static constexpr Color Snow_Gray           {GRAY::Gray254, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Mercury_Gray; }
+    };
+
+    /// @brief The data of the White palettes: the White range (`operator->()`) and the uniquely named White colors.
+    struct White_Palette {
+        typedef Defined_Colors::White WHITE;
+        inline static constexpr const char* group = "GrayScaleColors";
+        inline static constexpr const char* name = "White";
+        inline static constexpr const char* short_name = "W";
+
+        /// @brief The color codes of the range (White1 - White4), sorted from dark to light.
+        inline static constexpr WHITE range[] = {
+            WHITE::White7, WHITE::White255, WHITE::White15, WHITE::White231
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<White_Palette, BgColor> Colors;
+            inline static constexpr const Color& White1 = Colors::values[0];
+            inline static constexpr const Color& White2 = Colors::values[1];
+            inline static constexpr const Color& White3 = Colors::values[2];
+            inline static constexpr const Color& White4 = Colors::values[3];
+        };
+
+        template<bool BgColor>
+        struct Names {
+            inline static constexpr Color std_White       {WHITE::White7, BgColor};
+            inline static constexpr Color Snowflake_White {WHITE::White15, BgColor};
+            inline static constexpr Color Pure_White      {WHITE::White231, BgColor};
+            inline static constexpr Color Pearl_White     {WHITE::White255, BgColor};
+        };
+
+        template<bool BgColor>
+        static constexpr const Color& default_color() noexcept { return Names<BgColor>::Pure_White; }
+    };
+
+    /// @brief The data of the 'GrayScale Shades': 24 color steps going from dark- to light shades (ANSI 256 color codes 232 to 255).
+    ///        This palette does not define color names nor has it any unique color codes; it only consists of a range.
+    struct Shades_Palette {
+        typedef Defined_Colors::GrayScale GRAYSCALE;
+        inline static constexpr const char* group = "GrayScaleColors";
+        inline static constexpr const char* name = "Shades";
+        inline static constexpr const char* short_name = "S";
+
+        /// @brief The color codes of the range (Shade1 - Shade24), sorted from dark to light.
+        inline static constexpr GRAYSCALE range[] = {
+            GRAYSCALE::Black232, GRAYSCALE::Black233, GRAYSCALE::Gray234, GRAYSCALE::Gray235, GRAYSCALE::Gray236, GRAYSCALE::Gray237,
+            GRAYSCALE::Gray238, GRAYSCALE::Gray239, GRAYSCALE::Gray240, GRAYSCALE::Gray241, GRAYSCALE::Gray242, GRAYSCALE::Gray243,
+            GRAYSCALE::Gray244, GRAYSCALE::Gray245, GRAYSCALE::Gray246, GRAYSCALE::Gray247, GRAYSCALE::Gray248, GRAYSCALE::Gray249,
+            GRAYSCALE::Gray250, GRAYSCALE::Gray251, GRAYSCALE::Gray252, GRAYSCALE::Gray253, GRAYSCALE::Gray254, GRAYSCALE::White255
+        };
+
+        template<bool BgColor>
+        struct Range_Names {
+            typedef Palette_Colors<Shades_Palette, BgColor> Colors;
+            inline static constexpr const Color& Shade1  = Colors::values[0];
+            inline static constexpr const Color& Shade2  = Colors::values[1];
+            inline static constexpr const Color& Shade3  = Colors::values[2];
+            inline static constexpr const Color& Shade4  = Colors::values[3];
+            inline static constexpr const Color& Shade5  = Colors::values[4];
+            inline static constexpr const Color& Shade6  = Colors::values[5];
+            inline static constexpr const Color& Shade7  = Colors::values[6];
+            inline static constexpr const Color& Shade8  = Colors::values[7];
+            inline static constexpr const Color& Shade9  = Colors::values[8];
+            inline static constexpr const Color& Shade10 = Colors::values[9];
+            inline static constexpr const Color& Shade11 = Colors::values[10];
+            inline static constexpr const Color& Shade12 = Colors::values[11];
+            inline static constexpr const Color& Shade13 = Colors::values[12];
+            inline static constexpr const Color& Shade14 = Colors::values[13];
+            inline static constexpr const Color& Shade15 = Colors::values[14];
+            inline static constexpr const Color& Shade16 = Colors::values[15];
+            inline static constexpr const Color& Shade17 = Colors::values[16];
+            inline static constexpr const Color& Shade18 = Colors::values[17];
+            inline static constexpr const Color& Shade19 = Colors::values[18];
+            inline static constexpr const Color& Shade20 = Colors::values[19];
+            inline static constexpr const Color& Shade21 = Colors::values[20];
+            inline static constexpr const Color& Shade22 = Colors::values[21];
+            inline static constexpr const Color& Shade23 = Colors::values[22];
+            inline static constexpr const Color& Shade24 = Colors::values[23];
+        };
+    };
+
+    /// @brief This class defines the gray scale: Black, Gray, White and Shades.
+    template<bool BgColor>
+    class GrayScaleColors {
+        /// @brief Defines the GrayScale (color) Black in to 2 uniquely named color palettes.
+        typedef Color_Palette<Black_Palette, BgColor> _Black;
+        /// @brief Defines the GrayScale (color) Gray in to 2 uniquely named color palettes.
+        typedef Color_Palette<Gray_Palette, BgColor> _Gray;
+        /// @brief Defines the GrayScale (color) White in to 2 uniquely named color palettes.
+        typedef Color_Palette<White_Palette, BgColor> _White;
+        /// @brief Defines the 'GrayScale Shades' in to a subset of 24 color steps going from dark- to light shades. This palette does not define color names nor has it any unique color codes; it only acts as a step up grayscale shades interface ranging from ANSI 256 color code (232 to 255).
+        typedef Color_Range<Shades_Palette, BgColor> _Shades;
+
+        /// @brief Shortcut struct for easy access to ANSI 256 color definitions without typing full names.
+        ///        Use 'B' for Black, 'G' for Gray, 'W' for White, and 'S' for Shades to select the corresponding palette.
+        struct ShortCut {
+            const _Black B;
+            const _Gray G;
+            const _White W;
+            const _Shades S;
+            constexpr ShortCut() noexcept : B(true), G(true), W(true), S(true){}
+        };
+        const ShortCut short_cut;
+    public:
+        const _Black Black;
+        const _Gray Gray;
+        const _White White;
+        const _Shades Shades;
+
+        constexpr GrayScaleColors() noexcept : short_cut(), Black(false), Gray(false), White(false), Shades(false){}
+
+        /// @brief Overloads the `operator->()` as a shortcut for easy access to the (`ShortCut`) ANSI 256 palettes.
+        ///        Use 'B' for Black, 'G' for Gray, 'W' for White, and 'S' for Shades instead of their full palette names.
+        /// @return A pointer to the internal `short_cut` instance.
+        constexpr const ShortCut* operator->() const noexcept {
+            return &short_cut;
+        }
+    };
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Defines the `foreground` (text) ANSI 256 colors.
+    namespace fg
+    {
+        /// @brief This class defines the primary colors: Red, Green and Blue.
+        inline constexpr __LMN_color_categories_defined_::PrimaryColors<false> PrimaryColors {};
+        /// @brief This class defines the secondary colors: Cyan, Yellow and Purple.
+        inline constexpr __LMN_color_categories_defined_::SecondaryColors<false> SecondaryColors {};
+        /// @brief This class defines the Tertiary colors ('catch all' for all colors that are not primary- or secondary colors): Orange, Brown, Violet and Pink.
+        inline constexpr __LMN_color_categories_defined_::TertiaryColors<false> TertiaryColors {};
+        /// @brief This class defines the gray scale: Black, Gray, White and Shades.
+        inline constexpr __LMN_color_categories_defined_::GrayScaleColors<false> GrayScaleColors {};
+    }
+
+    /// @brief Defines the `background` ANSI 256 colors.
+    namespace bg
+    {
+        /// @brief This class defines the primary colors: Red, Green and Blue.
+        inline constexpr __LMN_color_categories_defined_::PrimaryColors<true> PrimaryColors {};
+        /// @brief This class defines the secondary colors: Cyan, Yellow and Purple.
+        inline constexpr __LMN_color_categories_defined_::SecondaryColors<true> SecondaryColors {};
+        /// @brief This class defines the Tertiary colors ('catch all' for all colors that are not primary- or secondary colors): Orange, Brown, Violet and Pink.
+        inline constexpr __LMN_color_categories_defined_::TertiaryColors<true> TertiaryColors {};
+        /// @brief This class defines the gray scale: Black, Gray, White and Shades.
+        inline constexpr __LMN_color_categories_defined_::GrayScaleColors<true> GrayScaleColors {};
+    }
+}
+
+#endif
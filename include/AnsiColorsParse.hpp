@@ -0,0 +1,145 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_PARSE_HPP
+#define LEMONCODE_ANSICOLORS_PARSE_HPP
+
+// Bulk parsing of color values (`#rrggbb` and `rgb(r, g, b)`), e.g. all colors of a set of theme files, in to RGB values and
+// ANSI 256 color codes.
+//
+// The values are parsed 8 at a time: the hex digits of a block are gathered in to one 48 byte buffer and decoded by a single
+// loop without branches (compilers vectorize it), checking all digits at once. `rgb(...)` values are parsed one by one.
+// The color codes are computed with `rgb_to_ansi256_batch()`.
+
+#include "AnsiColorsCore.hpp"
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+/// @brief Helper namespace for the bulk color parser.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_parse_helper_ {
+    /// @brief Decodes the 6 hex digits of 8 colors (`digits[6*color + i]`) in to RGB values (`rgb[3*color + i]`).
+    /// @return A mask with bit `color` set for every color that contains a character that is not a hex digit.
+    inline unsigned decodeHexBlock(const unsigned char (&digits)[48], uint8_t (&rgb)[24]) noexcept {
+        uint8_t values[48], invalid[48];
+        for(int i = 0; i < 48; ++i){
+            const uint8_t digit = static_cast<uint8_t>(digits[i] - '0'),
+                          letter = static_cast<uint8_t>((digits[i] | 0x20) - 'a');
+            values[i] = digit < 10 ? digit : static_cast<uint8_t>(letter + 10);
+            invalid[i] = (digit >= 10) & (letter >= 6);
+        }
+        for(int i = 0; i < 24; ++i) rgb[i] = static_cast<uint8_t>(values[2*i] << 4 | values[2*i + 1]);
+        unsigned mask = 0;
+        for(int color = 0; color < 8; ++color){
+            uint8_t any = 0;
+            for(int i = 0; i < 6; ++i) any |= invalid[6*color + i];
+            mask |= static_cast<unsigned>(any) << color;
+        }
+        return mask;
+    }
+
+    inline void skipSpaces(std::string_view& value) noexcept {
+        while(!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+    }
+
+    /// @brief Parses a decimal component (0 – 255) and the spaces around it.
+    inline bool parseComponent(std::string_view& value, uint8_t& component) noexcept {
+        skipSpaces(value);
+        int number = 0, digits = 0;
+        while(!value.empty() && value.front() >= '0' && value.front() <= '9' && digits < 4){
+            number = number*10 + (value.front() - '0');
+            value.remove_prefix(1);
+            ++digits;
+        }
+        skipSpaces(value);
+        component = static_cast<uint8_t>(number);
+        return digits != 0 && number <= 255;
+    }
+
+    /// @brief Parses `rgb(r, g, b)`.
+    inline bool parseFunctional(std::string_view value, uint8_t* rgb) noexcept {
+        if(value.size() < 10 || value.substr(0, 4) != "rgb(" || value.back() != ')') return false;
+        value = value.substr(4, value.size() - 5);
+        for(int i = 0; i < 3; ++i){
+            if(!parseComponent(value, rgb[i])) return false;
+            if(i < 2){
+                if(value.empty() || value.front() != ',') return false;
+                value.remove_prefix(1);
+            }
+        }
+        return value.empty();
+    }
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Parses color values in to RGB values. A value is `#rrggbb` (hex digits in either case) or `rgb(r, g, b)`
+    ///        (decimal 0 – 255, spaces allowed around the numbers).
+    /// @param values The color values.
+    /// @param count The number of values.
+    /// @param rgb Receives the red, green and blue component of every parsed value, back to back (3 * `count` bytes).
+    /// @return The number of values parsed: `count`, or the index of the first invalid value if there is one.
+    /// @code
+    /// const std::string_view values[] = {"#ff8800", "rgb(30, 30, 30)"};
+    /// uint8_t rgb[6];
+    /// if(ansi_colors::parse_rgb_colors(values, 2, rgb) != 2) ...
+    /// @endcode
+    inline std::size_t parse_rgb_colors(const std::string_view* values, std::size_t count, uint8_t* rgb) noexcept {
+        using namespace __LMN_parse_helper_;
+        for(std::size_t first = 0; first < count; first += 8){
+            const std::size_t lanes = count - first < 8 ? count - first : 8;
+            unsigned char digits[48];
+            std::memset(digits, '0', sizeof(digits));
+            uint8_t block[24];
+            unsigned hex = 0, invalid = 0;
+            for(std::size_t lane = 0; lane < lanes; ++lane){
+                const std::string_view value = values[first + lane];
+                if(value.size() == 7 && value[0] == '#'){
+                    std::memcpy(digits + 6*lane, value.data() + 1, 6);
+                    hex |= 1u << lane;
+                } else if(!parseFunctional(value, block + 3*lane)){
+                    invalid |= 1u << lane;
+                }
+            }
+            if(hex != 0){
+                uint8_t decoded[24];
+                invalid |= decodeHexBlock(digits, decoded) & hex;
+                for(std::size_t lane = 0; lane < lanes; ++lane){
+                    if(hex & (1u << lane)) std::memcpy(block + 3*lane, decoded + 3*lane, 3);
+                }
+            }
+            std::size_t parsed = lanes;
+            if(invalid != 0){
+                parsed = 0;
+                while(!(invalid & (1u << parsed))) ++parsed;
+            }
+            std::memcpy(rgb + 3*first, block, 3*parsed);
+            if(parsed != lanes) return first + parsed;
+        }
+        return count;
+    }
+
+    /// @brief Parses color values (see `parse_rgb_colors()`) in to the nearest ANSI 256 color codes.
+    /// @param codes Receives the color code of every parsed value (`count` bytes).
+    /// @return The number of values parsed: `count`, or the index of the first invalid value if there is one.
+    inline std::size_t parse_ansi256_colors(const std::string_view* values, std::size_t count, uint8_t* codes) noexcept {
+        uint8_t rgb[3 * 256];
+        for(std::size_t first = 0; first < count; first += 256){
+            const std::size_t chunk = count - first < 256 ? count - first : 256;
+            const std::size_t parsed = parse_rgb_colors(values + first, chunk, rgb);
+            rgb_to_ansi256_batch(rgb, codes + first, parsed);
+            if(parsed != chunk) return first + parsed;
+        }
+        return count;
+    }
+}
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_PROGRESS_HPP
+#define LEMONCODE_ANSICOLORS_PROGRESS_HPP
+
+#include "AnsiColorsCursor.hpp"
+#include "AnsiColorsGradient.hpp"
+#include <chrono>
+#include <vector>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The default minimum time between two redraws of a widget: one frame at 60 Hz.
+    inline constexpr std::chrono::microseconds Terminal_Refresh_Interval {16667};
+
+    /// @brief A progress bar that redraws incrementally: an update only emits the cells (and the percentage) that changed,
+    ///        positioned with cursor movement sequences, and updates are rate limited to the terminal refresh cadence.
+    ///
+    /// The bar has a resolution of 1/8 cell (using the Unicode block elements) and colors every filled cell with a fixed color,
+    /// or with the step of a `Color_Scale` that corresponds to the position of the cell.
+    /// The widget never writes to a stream itself; it appends to a caller provided buffer, so many bars can be batched in one write.
+    class Progress_Bar {
+        typedef std::chrono::steady_clock clock;
+
+        unsigned row, column;
+        std::vector<uint8_t> cell_color;
+        std::vector<uint8_t> drawn_level;   // 0 – 8 eighths per cell, 0xFF = not drawn yet.
+        uint8_t empty_color;
+        int drawn_percent = -1;
+        double pending = 0.0;
+        bool has_pending = false;
+        clock::duration interval;
+        clock::time_point last_draw {};
+
+        inline static constexpr const char* level_glyph[9] = {
+            "░", "▏", "▎", "▍", "▌", "▋", "▊", "▉", "█"
+        };
+
+        void draw(double fraction, std::string& out){
+            fraction = fraction < 0.0 ? 0.0 : (fraction > 1.0 ? 1.0 : fraction);
+            const std::size_t width = cell_color.size();
+            const std::size_t eighths = static_cast<std::size_t>(fraction * static_cast<double>(width * 8) + 0.5);
+
+            int current_color = -1;
+            std::size_t cursor = static_cast<std::size_t>(-1);     // The cell the terminal cursor is at, if known.
+            for(std::size_t cell = 0; cell < width; ++cell){
+                const std::size_t filled = cell * 8 < eighths ? eighths - cell * 8 : 0;
+                const uint8_t level = static_cast<uint8_t>(filled > 8 ? 8 : filled);
+                if(drawn_level[cell] == level) continue;
+
+                if(cursor != cell) Cursor::append_move_to(out, row, column + static_cast<unsigned>(cell));
+                const uint8_t color = level == 0 ? empty_color : cell_color[cell];
+                if(current_color != color){
+                    Cursor::append_color(out, color, false);
+                    current_color = color;
+                }
+                out += level_glyph[level];
+                drawn_level[cell] = level;
+                cursor = cell + 1;
+            }
+
+            const int percent = static_cast<int>(fraction * 100.0);
+            if(percent != drawn_percent){
+                if(cursor != width) Cursor::append_move_to(out, row, column + static_cast<unsigned>(width));
+                if(current_color != -1) out += Reset::FgColor;
+                current_color = -1;
+                out += ' ';
+                if(percent < 100) out += ' ';
+                if(percent < 10) out += ' ';
+                Cursor::append_number(out, static_cast<unsigned>(percent));
+                out += '%';
+                drawn_percent = percent;
+            }
+            if(current_color != -1) out += Reset::FgColor;
+            has_pending = false;
+        }
+    public:
+        Progress_Bar() = delete;
+
+        /// @brief Creates a progress bar filled with a single color.
+        /// @param row The 1-based screen row of the bar.
+        /// @param column The 1-based screen column of the first cell.
+        /// @param width The number of cells of the bar (the percentage is drawn after the last cell).
+        /// @param fill The color (code) of the filled cells.
+        /// @param empty The color (code) of the empty cells. Default = `Shades` step 6 (code 237).
+        /// @param interval The minimum time between two redraws. Default = `Terminal_Refresh_Interval`.
+        Progress_Bar(unsigned row, unsigned column, unsigned width, uint8_t fill, uint8_t empty = 237,
+                     clock::duration interval = Terminal_Refresh_Interval)
+            : row(row), column(column), cell_color(width, fill), drawn_level(width, 0xFF), empty_color(empty), interval(interval){}
+
+        /// @brief Creates a progress bar whose filled cells follow a color scale from the first to the last cell.
+        /// @param scale The color scale, e.g. `make_gradient<16>(...)`.
+        template<std::size_t N>
+        Progress_Bar(unsigned row, unsigned column, unsigned width, const Color_Scale<N>& scale, uint8_t empty = 237,
+                     clock::duration interval = Terminal_Refresh_Interval)
+            : Progress_Bar(row, column, width, scale[0], empty, interval){
+            for(unsigned cell = 0; cell < width; ++cell){
+                cell_color[cell] = scale.sample((static_cast<double>(cell) + 0.5) / static_cast<double>(width));
+            }
+        }
+
+        /// @brief Sets the progress and appends the sequences for the changed cells to `out`.
+        ///        If the last redraw is less than the interval ago the update is only remembered (see `flush()`),
+        ///        except for the completing update (fraction >= 1.0), which is always drawn.
+        /// @param fraction The progress (0.0 – 1.0).
+        /// @param out The buffer to append the sequences to.
+        /// @param now The current time. Default = `std::chrono::steady_clock::now()`.
+        /// @return True if the bar was redrawn; false if the update was deferred by the rate limit.
+        bool update(double fraction, std::string& out, clock::time_point now = clock::now()){
+            if(fraction < 1.0 && now - last_draw < interval){
+                pending = fraction;
+                has_pending = true;
+                return false;
+            }
+            last_draw = now;
+            draw(fraction, out);
+            return true;
+        }
+
+        /// @brief Draws an update that was deferred by the rate limit, if any.
+        /// @param out The buffer to append the sequences to.
+        void flush(std::string& out){
+            if(has_pending) draw(pending, out);
+        }
+
+        /// @brief Forgets what is on screen, so that the next update redraws the whole bar (e.g. after the screen was cleared).
+        void invalidate() noexcept {
+            for(uint8_t& level : drawn_level) level = 0xFF;
+            drawn_percent = -1;
+        }
+
+        ~Progress_Bar() noexcept = default;
+    };
+
+    /// @brief A single cell spinner that cycles through glyph frames and colors; a tick only emits one cell.
+    class Spinner {
+        typedef std::chrono::steady_clock clock;
+
+        unsigned row, column;
+        std::vector<uint8_t> colors;
+        std::size_t frame = 0;
+        clock::duration interval;
+        clock::time_point last_draw {};
+
+        inline static constexpr const char* frames[10] = {
+            "⠋", "⠙", "⠹", "⠸", "⠼", "⠴", "⠦", "⠧", "⠇", "⠏"
+        };
+    public:
+        Spinner() = delete;
+
+        /// @brief Creates a spinner with a single color.
+        /// @param row The 1-based screen row of the spinner.
+        /// @param column The 1-based screen column of the spinner.
+        /// @param color The color (code) of the spinner.
+        /// @param interval The minimum time between two frames. Default = 80 ms.
+        Spinner(unsigned row, unsigned column, uint8_t color, clock::duration interval = std::chrono::milliseconds(80))
+            : row(row), column(column), colors(1, color), interval(interval){}
+
+        /// @brief Creates a spinner that cycles through the colors of a scale (forwards, then backwards), e.g. the `Shades`.
+        template<std::size_t N>
+        Spinner(unsigned row, unsigned column, const Color_Scale<N>& scale, clock::duration interval = std::chrono::milliseconds(80))
+            : row(row), column(column), colors(scale.begin(), scale.end()), interval(interval){
+            for(std::size_t step = scale.size() - 1; step-- > 1;) colors.push_back(scale[step]);
+        }
+
+        /// @brief Advances the spinner if the interval has passed and appends the sequences for the new frame to `out`.
+        /// @param out The buffer to append the sequences to.
+        /// @param now The current time. Default = `std::chrono::steady_clock::now()`.
+        /// @return True if a new frame was drawn.
+        bool tick(std::string& out, clock::time_point now = clock::now()){
+            if(now - last_draw < interval) return false;
+            last_draw = now;
+            Cursor::append_move_to(out, row, column);
+            Cursor::append_color(out, colors[frame % colors.size()], false);
+            out += frames[frame % 10];
+            out += Reset::FgColor;
+            ++frame;
+            return true;
+        }
+
+        ~Spinner() noexcept = default;
+    };
+}
+
+#endif
@@ -0,0 +1,452 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_RECORDING_HPP
+#define LEMONCODE_ANSICOLORS_RECORDING_HPP
+
+// A compact binary format for recorded (styled) terminal output, with a writer and a memory mapped reader.
+//
+// Layout (all integers little endian):
+//   header       "LMNREC01", uint32 version (1), uint32 style count, uint64 run count, uint64 runs size,
+//                uint64 text size                                                                          (40 bytes)
+//   styles       style count x uint32: the packed `Cell_Style`s (fg/bg color code and attributes)
+//   padding      to a multiple of 8 bytes
+//   checkpoints  ceil(run count / 256) x (uint64 text offset, uint64 runs offset) of run 0, 256, 512, ... (for seeking)
+//   runs         runs size bytes: run count x (varint style index, varint length), the style of the next `length` text bytes
+//   text         text size bytes: the plain text, without escape sequences
+//
+// A varint is the LEB128 encoding: 7 bits per byte, least significant first, the high bit set on all but the last byte.
+// A typical run (one of the first 128 styles, shorter than 16 KiB) takes 2 - 3 bytes.
+// The text is stored as is, so plain text conversion is a single copy and searching needs no decoding at all.
+
+#include "AnsiColorsColorize.hpp"
+#include "AnsiColorsStyled.hpp"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Helper namespace for the (little endian) encoding of recordings.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_recording_helper_ {
+    inline constexpr char magic[8] = {'L', 'M', 'N', 'R', 'E', 'C', '0', '1'};
+    inline constexpr uint32_t version = 1;
+    inline constexpr std::size_t header_size = 40;
+    inline constexpr std::size_t checkpoint_interval = 256;
+
+    inline void put32(std::string& out, uint32_t value){
+        for(int shift = 0; shift < 32; shift += 8) out += static_cast<char>((value >> shift) & 0xFF);
+    }
+
+    inline void put64(std::string& out, uint64_t value){
+        for(int shift = 0; shift < 64; shift += 8) out += static_cast<char>((value >> shift) & 0xFF);
+    }
+
+    inline void putVarint(std::string& out, uint64_t value){
+        for(; value >= 0x80; value >>= 7) out += static_cast<char>((value & 0x7F) | 0x80);
+        out += static_cast<char>(value);
+    }
+
+    inline uint32_t get32(const char* data) noexcept {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        return uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]) << 16) | (uint32_t(bytes[3]) << 24);
+    }
+
+    inline uint64_t get64(const char* data) noexcept {
+        return uint64_t(get32(data)) | (uint64_t(get32(data + 4)) << 32);
+    }
+
+    /// @brief Decodes a varint at `data` and advances `data` past it.
+    /// @return false if it runs past `end` or is longer than 10 bytes.
+    inline bool getVarint(const char*& data, const char* end, uint64_t& value) noexcept {
+        value = 0;
+        for(int shift = 0; data < end && shift < 70; shift += 7){
+            const unsigned char byte = static_cast<unsigned char>(*data++);
+            value |= uint64_t(byte & 0x7F) << shift;
+            if((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Builds a recording: styled text goes in (as text and a `Cell_Style`, or as raw ANSI output), the binary format comes out.
+    ///        Equal styles share one style table entry, and consecutive text in the same style is merged in to one run.
+    class Recording_Writer {
+        std::string text;
+        std::vector<uint32_t> styles;
+        std::unordered_map<uint32_t, uint32_t> style_index;
+        std::vector<std::pair<uint32_t, uint64_t>> runs;    // (style index, length)
+
+        // The state of the raw ANSI parser.
+        uint32_t ansi_style = Cell_Style::Default;
+        std::string pending_escape;
+
+        uint32_t indexOf(uint32_t style){
+            auto found = style_index.find(style);
+            if(found != style_index.end()) return found->second;
+            styles.push_back(style);
+            style_index.emplace(style, static_cast<uint32_t>(styles.size() - 1));
+            return static_cast<uint32_t>(styles.size() - 1);
+        }
+
+        void applySgr(std::string_view parameters){
+            uint32_t values[32];
+            std::size_t count = 0;
+            values[0] = 0;
+            for(char c : parameters){
+                if(c >= '0' && c <= '9'){
+                    if(count == 0) count = 1;
+                    values[count - 1] = values[count - 1] * 10 + static_cast<uint32_t>(c - '0');
+                } else if(c == ';' || c == ':'){
+                    if(count == 0) count = 1;
+                    if(count < 32) values[count++] = 0;
+                }
+            }
+            if(count == 0) count = 1;
+            // SGR parameters that switch an attribute on and off, indexed by attribute bit (as in `Cell_Style`).
+            constexpr unsigned on[8] = {1, 2, 3, 4, 5, 7, 8, 9};
+            uint32_t& style = ansi_style;
+            for(std::size_t index = 0; index < count; ++index){
+                const uint32_t value = values[index];
+                if(value == 0){
+                    style = Cell_Style::Default;
+                } else if(value == 22){
+                    style &= ~(Cell_Style::Bold | Cell_Style::Faint);
+                } else if(value >= 23 && value <= 29){
+                    for(unsigned bit = 2; bit < 8; ++bit){
+                        if(on[bit] + 20 == value) style &= ~(1u << (16 + bit));
+                    }
+                } else if(value < 10){
+                    for(unsigned bit = 0; bit < 8; ++bit){
+                        if(on[bit] == value) style |= 1u << (16 + bit);
+                    }
+                } else if((value >= 30 && value <= 37) || (value >= 90 && value <= 97)){
+                    style = (style & ~0xFFu) | Cell_Style::fg(static_cast<uint8_t>(value < 90 ? value - 30 : value - 90 + 8));
+                } else if((value >= 40 && value <= 47) || (value >= 100 && value <= 107)){
+                    style = (style & ~0xFF00u) | Cell_Style::bg(static_cast<uint8_t>(value < 100 ? value - 40 : value - 100 + 8));
+                } else if(value == 39){
+                    style &= ~(Cell_Style::FgSet | 0xFFu);
+                } else if(value == 49){
+                    style &= ~(Cell_Style::BgSet | 0xFF00u);
+                } else if((value == 38 || value == 48) && index + 1 < count){
+                    uint8_t code = 0;
+                    if(values[index + 1] == 5 && index + 2 < count){
+                        code = static_cast<uint8_t>(values[index + 2]);
+                        index += 2;
+                    } else if(values[index + 1] == 2 && index + 4 < count){
+                        code = rgb_to_ansi256(static_cast<uint8_t>(values[index + 2]), static_cast<uint8_t>(values[index + 3]), static_cast<uint8_t>(values[index + 4]));
+                        index += 4;
+                    } else {
+                        break;
+                    }
+                    style = value == 38 ? (style & ~0xFFu) | Cell_Style::fg(code) : (style & ~0xFF00u) | Cell_Style::bg(code);
+                }
+            }
+        }
+    public:
+        /// @brief Appends text in a packed `Cell_Style`.
+        void write(std::string_view part, uint32_t style = Cell_Style::Default){
+            if(part.empty()) return;
+            const uint32_t index = indexOf(style);
+            if(!runs.empty() && runs.back().first == index) runs.back().second += part.size();
+            else runs.emplace_back(index, part.size());
+            text += part;
+        }
+
+        /// @brief Appends a `Styled_String`; its style runs map directly on to recording runs.
+        void write(const Styled_String& styled){
+            const std::vector<Styled_String::Run>& styled_runs = styled.style_runs();
+            std::size_t offset = 0;
+            uint32_t style = Cell_Style::Default;
+            for(const Styled_String::Run& run : styled_runs){
+                write(std::string_view(styled.text()).substr(offset, run.offset - offset), style);
+                offset = run.offset;
+                style = run.style;
+            }
+            write(std::string_view(styled.text()).substr(offset), style);
+        }
+
+        /// @brief Appends raw terminal output (e.g. a capture of a CLI session). SGR sequences are converted to styles;
+        ///        true colors are mapped with `rgb_to_ansi256()`. Other escape sequences (cursor movement, ...) are dropped.
+        ///        Escape sequences may be split over calls.
+        void write_ansi(std::string_view output){
+            std::size_t start = 0;
+            for(std::size_t position = 0; position < output.size(); ++position){
+                const char c = output[position];
+                if(pending_escape.empty()){
+                    if(c != '\033') continue;
+                    write(output.substr(start, position - start), ansi_style);
+                    pending_escape += c;
+                    continue;
+                }
+                pending_escape += c;
+                const unsigned char byte = static_cast<unsigned char>(c);
+                const bool csi = pending_escape.size() > 1 && pending_escape[1] == '[';
+                bool done = false;
+                if(pending_escape.size() == 2 && c != '[') done = byte < 0x20 || byte > 0x2F;
+                else if(!csi && pending_escape.size() > 2) done = byte < 0x20 || byte > 0x2F;
+                else if(csi && pending_escape.size() > 2) done = byte >= 0x40 && byte <= 0x7E;
+                if(done){
+                    if(csi && c == 'm') applySgr(std::string_view(pending_escape).substr(2, pending_escape.size() - 3));
+                    pending_escape.clear();
+                    start = position + 1;
+                }
+            }
+            if(pending_escape.empty()) write(output.substr(start), ansi_style);
+        }
+
+        /// @brief Returns the size of the plain text so far, in bytes.
+        std::size_t text_size() const noexcept { return text.size(); }
+
+        /// @brief Returns the recording in the binary format.
+        std::string serialize() const {
+            using namespace __LMN_recording_helper_;
+            const std::size_t checkpoints = (runs.size() + checkpoint_interval - 1) / checkpoint_interval;
+            std::string encoded_runs, encoded_checkpoints;
+            encoded_runs.reserve(runs.size() * 3);
+            encoded_checkpoints.reserve(checkpoints * 16);
+            uint64_t offset = 0;
+            for(std::size_t run = 0; run < runs.size(); ++run){
+                if(run % checkpoint_interval == 0){
+                    put64(encoded_checkpoints, offset);
+                    put64(encoded_checkpoints, encoded_runs.size());
+                }
+                putVarint(encoded_runs, runs[run].first);
+                putVarint(encoded_runs, runs[run].second);
+                offset += runs[run].second;
+            }
+            std::string out;
+            out.reserve(header_size + styles.size() * 4 + 4 + encoded_checkpoints.size() + encoded_runs.size() + text.size());
+            out.append(magic, sizeof(magic));
+            put32(out, version);
+            put32(out, static_cast<uint32_t>(styles.size()));
+            put64(out, runs.size());
+            put64(out, encoded_runs.size());
+            put64(out, text.size());
+            for(uint32_t style : styles) put32(out, style);
+            if(out.size() % 8 != 0) put32(out, 0);
+            out += encoded_checkpoints;
+            out += encoded_runs;
+            out += text;
+            return out;
+        }
+
+        /// @brief Writes the recording to a file.
+        /// @throws std::runtime_error if the file cannot be written.
+        void save(const std::string& path) const {
+            const std::string data = serialize();
+            int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if(fd < 0) throw std::runtime_error("\nERROR: Cannot create '"+path+"': "+std::strerror(errno)+"\n");
+            std::size_t written = 0;
+            while(written < data.size()){
+                const ssize_t count = ::write(fd, data.data() + written, data.size() - written);
+                if(count < 0){
+                    if(errno == EINTR) continue;
+                    const std::string reason = std::strerror(errno);
+                    ::close(fd);
+                    throw std::runtime_error("\nERROR: Cannot write '"+path+"': "+reason+"\n");
+                }
+                written += static_cast<std::size_t>(count);
+            }
+            ::close(fd);
+        }
+    };
+
+    /// @brief A memory mapped recording. Nothing is decoded up front (only the checkpoints are checked): the style table,
+    ///        runs and text are read in place, so seeking is a binary search over the checkpoints plus at most 256 runs, and a part of the
+    ///        recording can be rendered without touching the rest.
+    class Recording {
+        Mapped_File file;
+        const char* styles_data = nullptr;
+        const char* checkpoints_data = nullptr;
+        const char* runs_data = nullptr;
+        const char* runs_end = nullptr;
+        std::string_view text_data;
+        uint32_t style_count = 0;
+        uint64_t run_count = 0;
+
+        [[noreturn]] static void throwInvalid(const std::string& path, const char* what){
+            throw std::runtime_error("\nERROR: '"+path+"' is not a valid recording: "+what+"\n");
+        }
+
+        /// @brief A decoding position: the next run, where it's encoded, and its text offset.
+        struct Cursor {
+            std::size_t run;
+            const char* data;
+            uint64_t start;
+        };
+
+        std::size_t checkpointCount() const noexcept {
+            return static_cast<std::size_t>((run_count + __LMN_recording_helper_::checkpoint_interval - 1) / __LMN_recording_helper_::checkpoint_interval);
+        }
+
+        uint64_t checkpointOffset(std::size_t index) const noexcept { return __LMN_recording_helper_::get64(checkpoints_data + index * 16); }
+
+        Cursor checkpointCursor(std::size_t index) const noexcept {
+            return Cursor{index * __LMN_recording_helper_::checkpoint_interval,
+                          runs_data + __LMN_recording_helper_::get64(checkpoints_data + index * 16 + 8), checkpointOffset(index)};
+        }
+
+        /// @brief Decodes the run at `cursor` and moves the cursor to the next one.
+        /// @throws std::runtime_error if the run is corrupt (past the runs or the text, or an unknown style).
+        void nextRun(Cursor& cursor, uint32_t& index, uint64_t& end) const {
+            uint64_t value = 0, length = 0;
+            if(!__LMN_recording_helper_::getVarint(cursor.data, runs_end, value) || !__LMN_recording_helper_::getVarint(cursor.data, runs_end, length)
+               || value >= style_count || length > text_data.size() - cursor.start){
+                throw std::runtime_error("\nERROR: Corrupt run in recording\n");
+            }
+            index = static_cast<uint32_t>(value);
+            end = cursor.start + length;
+            ++cursor.run;
+        }
+
+        /// @brief Returns the cursor of the run that contains text offset `offset` (`offset` < text size).
+        Cursor cursorAt(std::size_t offset) const {
+            std::size_t low = 0, high = checkpointCount();
+            while(low + 1 < high){
+                const std::size_t middle = (low + high) / 2;
+                if(checkpointOffset(middle) <= offset) low = middle;
+                else high = middle;
+            }
+            Cursor cursor = checkpointCursor(low);
+            while(cursor.run + 1 < run_size()){
+                Cursor next = cursor;
+                uint32_t index;
+                uint64_t end;
+                nextRun(next, index, end);
+                if(end > offset) break;
+                next.start = end;
+                cursor = next;
+            }
+            return cursor;
+        }
+    public:
+        /// @brief A run of text in one style.
+        struct Run {
+            std::string_view text;
+            uint32_t style;
+        };
+
+        /// @brief Maps a recording and checks its header and section sizes.
+        /// @throws std::runtime_error if the file cannot be mapped or is not a (valid) recording.
+        explicit Recording(const std::string& path) : file(path){
+            using namespace __LMN_recording_helper_;
+            const std::string_view data = file.view();
+            if(data.size() < header_size || data.compare(0, sizeof(magic), std::string_view(magic, sizeof(magic))) != 0) throwInvalid(path, "bad header");
+            if(get32(data.data() + 8) != version) throwInvalid(path, "unsupported version");
+            style_count = get32(data.data() + 12);
+            run_count = get64(data.data() + 16);
+            const uint64_t runs_size = get64(data.data() + 24);
+            const uint64_t text_size = get64(data.data() + 32);
+            uint64_t offset = header_size + uint64_t(style_count) * 4;
+            offset += offset % 8;
+            const uint64_t runs_offset = offset + (run_count + checkpoint_interval - 1) / checkpoint_interval * 16;
+            if(run_count > data.size() || runs_size > data.size() || text_size > data.size() || runs_offset + runs_size + text_size != data.size()){
+                throwInvalid(path, "section sizes don't match the file size");
+            }
+            if(run_count == 0 && text_size != 0) throwInvalid(path, "text without runs");
+            styles_data = data.data() + header_size;
+            checkpoints_data = data.data() + offset;
+            runs_data = data.data() + runs_offset;
+            runs_end = runs_data + runs_size;
+            text_data = data.substr(static_cast<std::size_t>(runs_offset + runs_size));
+            // `cursorAt()` binary searches the checkpoints, so their offsets must not decrease.
+            uint64_t previous_text = 0, previous_runs = 0;
+            for(std::size_t index = 0; index < checkpointCount(); ++index){
+                const uint64_t text_offset = checkpointOffset(index), runs_offset = get64(checkpoints_data + index * 16 + 8);
+                if(text_offset > text_size || runs_offset > runs_size) throwInvalid(path, "checkpoint out of range");
+                if(text_offset < previous_text || runs_offset < previous_runs) throwInvalid(path, "checkpoints out of order");
+                previous_text = text_offset;
+                previous_runs = runs_offset;
+            }
+        }
+
+        /// @brief Returns the plain text of the whole recording (directly from the mapping).
+        std::string_view text() const noexcept { return text_data; }
+
+        std::size_t run_size() const noexcept { return static_cast<std::size_t>(run_count); }
+        std::size_t style_size() const noexcept { return style_count; }
+
+        /// @brief Returns an entry of the style table.
+        uint32_t style(std::size_t index) const noexcept { return __LMN_recording_helper_::get32(styles_data + index * 4); }
+
+        /// @brief Returns the index of the run that contains text offset `offset` (or `run_size()` if it's past the end).
+        /// @throws std::runtime_error if a run on the way is corrupt.
+        std::size_t seek(std::size_t offset) const {
+            if(offset >= text_data.size()) return run_size();
+            return cursorAt(offset).run;
+        }
+
+        /// @brief Calls `callback(Run)` for every run that overlaps the text bytes `from` – `to`, cut to that range
+        ///        (e.g. to convert a recording to HTML or to another format).
+        /// @throws std::runtime_error if a run refers to a style that isn't in the style table, or runs past the text.
+        template<typename Callback>
+        void for_each_run(Callback&& callback, std::size_t from = 0, std::size_t to = std::string_view::npos) const {
+            if(to > text_data.size()) to = text_data.size();
+            if(from >= to) return;
+            Cursor cursor = cursorAt(from);
+            while(cursor.run < run_size() && cursor.start < to){
+                uint32_t index;
+                uint64_t end;
+                nextRun(cursor, index, end);
+                const std::size_t first = static_cast<std::size_t>(cursor.start < from ? from : cursor.start);
+                const std::size_t last = static_cast<std::size_t>(end > to ? to : end);
+                if(first < last) callback(Run{text_data.substr(first, last - first), style(index)});
+                cursor.start = end;
+            }
+        }
+
+        /// @brief Appends the text bytes `from` – `to` with escape sequences for the given color depth, starting from and
+        ///        ending with the default style. The colors are remapped for the color vision of the viewer (see `color_vision_map()`).
+        void render(std::string& out, Color_Depth depth = Color_Depth::Ansi256, std::size_t from = 0, std::size_t to = std::string_view::npos,
+                    Color_Vision vision = Color_Vision::Normal) const {
+            uint32_t current = Cell_Style::Default;
+            for_each_run([&](const Run& run){
+                Cell_Style::append_transition(out, current, run.style, depth, vision);
+                current = run.style;
+                out += run.text;
+            }, from, to);
+            Cell_Style::append_transition(out, current, Cell_Style::Default, depth, vision);
+        }
+
+        /// @brief Replays the recording (or a part of it) to a file descriptor (e.g. `STDOUT_FILENO`), in blocks of about 64 KiB.
+        /// @throws std::runtime_error if writing fails.
+        void replay(int out_fd, Color_Depth depth = Color_Depth::Ansi256, std::size_t from = 0, std::size_t to = std::string_view::npos,
+                    Color_Vision vision = Color_Vision::Normal) const {
+            std::string block;
+            block.reserve(std::size_t(80) << 10);
+            auto flush = [&block, out_fd]{
+                std::size_t written = 0;
+                while(written < block.size()){
+                    const ssize_t count = ::write(out_fd, block.data() + written, block.size() - written);
+                    if(count < 0){
+                        if(errno == EINTR) continue;
+                        throw std::runtime_error(std::string("\nERROR: Cannot write the recording: ")+std::strerror(errno)+"\n");
+                    }
+                    written += static_cast<std::size_t>(count);
+                }
+                block.clear();
+            };
+            uint32_t current = Cell_Style::Default;
+            for_each_run([&](const Run& run){
+                Cell_Style::append_transition(block, current, run.style, depth, vision);
+                current = run.style;
+                block += run.text;
+                if(block.size() >= (std::size_t(64) << 10)) flush();
+            }, from, to);
+            Cell_Style::append_transition(block, current, Cell_Style::Default, depth, vision);
+            flush();
+        }
+    };
+}
+
+#endif
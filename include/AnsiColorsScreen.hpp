@@ -0,0 +1,139 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_SCREEN_HPP
+#define LEMONCODE_ANSICOLORS_SCREEN_HPP
+
+#include "AnsiColorsCell.hpp"
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief A double buffered grid of cells that renders to the terminal by difference.
+    ///
+    /// All drawing goes to the back buffer; the front buffer holds what is on the terminal.
+    /// `present()` compares both buffers and only emits the changed spans: one cursor move per span
+    /// and one coalesced SGR sequence per style change (see `Cell_Style::append_transition()`).
+    /// The back buffer is retained after presenting, so only the cells that change need to be drawn again.
+    /// Both buffers are `Cell_Grid`s, so unchanged rows are skipped with two aligned block compares.
+    /// Every cell is assumed to be one column wide.
+    class Screen {
+        unsigned row_count, column_count;
+        Cell_Grid front, back;
+        Color_Vision vision = Color_Vision::Normal;
+
+        /// @brief A cell that never equals a drawn cell, used to force a redraw.
+        inline static constexpr Cell invalid_cell {0xFFFFFFFFu, 0xFFFFFFFFu};
+
+        /// @brief Unchanged cells between two changed spans are rewritten (instead of moving the cursor) if the gap is at most this wide.
+        inline static constexpr unsigned max_bridged_gap = 4;
+    public:
+        Screen() = delete;
+
+        /// @brief Creates a screen of the given size; the first `present()` draws every cell.
+        /// @param rows The number of rows.
+        /// @param columns The number of columns.
+        Screen(unsigned rows, unsigned columns)
+            : row_count(rows), column_count(columns), front(rows, columns, invalid_cell), back(rows, columns){}
+
+        unsigned rows() const noexcept { return row_count; }
+        unsigned columns() const noexcept { return column_count; }
+
+        /// @brief Sets a cell of the back buffer. Positions outside the screen are ignored.
+        /// @param row The 0-based row.
+        /// @param column The 0-based column.
+        /// @param glyph The code point of the cell.
+        /// @param style The packed `Cell_Style`.
+        void put(unsigned row, unsigned column, char32_t glyph, uint32_t style = Cell_Style::Default) noexcept {
+            if(row < row_count && column < column_count) back.set(row, column, Cell{glyph, style});
+        }
+
+        /// @brief Writes UTF-8 text in to the back buffer, starting at the given position. Text past the last column is cut off.
+        /// @return The column after the last written cell.
+        unsigned write(unsigned row, unsigned column, std::string_view text, uint32_t style = Cell_Style::Default) noexcept {
+            while(!text.empty() && column < column_count){
+                put(row, column++, __LMN_utf8_helper_::next(text), style);
+            }
+            return column;
+        }
+
+        /// @brief Returns a cell of the back buffer.
+        Cell at(unsigned row, unsigned column) const noexcept { return back.at(row, column); }
+
+        /// @brief Returns the back buffer, for direct (row wise) drawing.
+        Cell_Grid& buffer() noexcept { return back; }
+
+        /// @brief Fills the back buffer with blank cells of the given style.
+        void clear(uint32_t style = Cell_Style::Default) noexcept {
+            back.fill(Cell{U' ', style});
+        }
+
+        /// @brief Forgets what is on the terminal, so that the next `present()` redraws every cell (e.g. after a resize or clear).
+        void invalidate() noexcept {
+            front.fill(invalid_cell);
+        }
+
+        /// @brief Sets the color vision of the viewer: from the next `present()` on, which redraws every cell, all colors are
+        ///        remapped for it (see `color_vision_map()`).
+        void set_color_vision(Color_Vision vision) noexcept {
+            if(vision == this->vision) return;
+            this->vision = vision;
+            invalidate();
+        }
+
+        Color_Vision color_vision() const noexcept { return vision; }
+
+        /// @brief Appends the sequences that bring the terminal from the front buffer to the back buffer, then makes both equal.
+        ///        The terminal is left with the default style. Nothing is appended if nothing changed.
+        /// @param out The buffer to append to; write it to the terminal in one go.
+        void present(std::string& out){
+            uint32_t current_style = Cell_Style::Default;
+            bool style_known = false;
+            for(unsigned row = 0; row < row_count; ++row){
+                if(front.row_equal(back, row)) continue;
+
+                const char32_t* back_glyph = back.glyph_row(row);
+                const uint32_t* back_style = back.style_row(row);
+                char32_t* front_glyph = front.glyph_row(row);
+                uint32_t* front_style = front.style_row(row);
+                auto emit = [&](unsigned column){
+                    if(!style_known){
+                        // The style of the terminal is unknown at the start; reset it once.
+                        out += Reset::All;
+                        style_known = true;
+                    }
+                    Cell_Style::append_transition(out, current_style, back_style[column], Color_Depth::Ansi256, vision);
+                    current_style = back_style[column];
+                    __LMN_utf8_helper_::append(out, back_glyph[column]);
+                    front_glyph[column] = back_glyph[column];
+                    front_style[column] = back_style[column];
+                };
+
+                unsigned cursor = column_count + 1;     // The column the terminal cursor is at, if on this row.
+                for(unsigned column = 0; column < column_count; ++column){
+                    if(front_glyph[column] == back_glyph[column] && front_style[column] == back_style[column]) continue;
+
+                    if(cursor < column && column - cursor <= max_bridged_gap){
+                        // Bridge a small gap by rewriting the unchanged cells, cheaper than a cursor move.
+                        for(; cursor < column; ++cursor) emit(cursor);
+                    } else if(cursor != column){
+                        Cursor::append_move_to(out, row + 1, column + 1);
+                    }
+                    emit(column);
+                    cursor = column + 1;
+                }
+            }
+            if(current_style != Cell_Style::Default) out += Reset::All;
+        }
+
+        ~Screen() noexcept = default;
+    };
+}
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_STREAM_HPP
+#define LEMONCODE_ANSICOLORS_STREAM_HPP
+
+// The std::ostream integration: `operator<<` for `Color` and the palettes, for both `std::ostream` and `std::wostream`,
+// and the per stream color vision switch (`set_color_vision()`).
+
+#include "AnsiColorsPalette.hpp"
+#include "AnsiColorsVision.hpp"
+#include "AnsiColorsWide.hpp"
+#include <ostream>
+
+/// @brief Helper namespace for the stream state of this API.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_stream_helper_ {
+    /// @brief The `std::ios_base::iword()` slot that holds the `Color_Vision` of a stream (0 = `Color_Vision::Normal`).
+    inline const int color_vision_slot = std::ios_base::xalloc();
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The stream manipulator returned by `set_color_vision()`.
+    struct Color_Vision_Setting {
+        Color_Vision vision;
+    };
+
+    /// @brief Sets the color vision of the viewer of a stream: all colors written to it afterwards are remapped for it
+    ///        (see `color_vision_map()`), at the cost of one table index per color.
+    /// @code
+    /// std::cout<< ansi_colors::set_color_vision(Color_Vision::Deuteranopia)<< fg::PrimaryColors.Red<< "failed"<< Reset::All;
+    /// @endcode
+    constexpr Color_Vision_Setting set_color_vision(Color_Vision vision) noexcept { return Color_Vision_Setting{vision}; }
+
+    template<typename CharT, typename Traits>
+    inline std::basic_ostream<CharT, Traits>&operator<<(std::basic_ostream<CharT, Traits>& os, Color_Vision_Setting setting){
+        os.iword(__LMN_stream_helper_::color_vision_slot) = static_cast<long>(setting.vision);
+        return os;
+    }
+
+    /// @brief Returns the color vision of a stream (`Color_Vision::Normal` unless it was set with `set_color_vision()`).
+    inline Color_Vision color_vision(std::ios_base& stream){
+        return static_cast<Color_Vision>(stream.iword(__LMN_stream_helper_::color_vision_slot) & 3);
+    }
+
+    /// @brief Overloaded ostream operator for direct output using std::cout or similar.
+    inline std::ostream&operator<<(std::ostream& os, const Color& color) {
+        using __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::getAnsi256Code;
+
+        const uint8_t code = color_vision_map(color_vision(os))[color.colorCode()];
+        os<< (color.isBackgroundColor() ? Reset::BgColor : Reset::FgColor)<< getAnsi256Code(code, color.isBackgroundColor());
+        return os;
+    }
+
+    /// @brief Overloaded wostream operator for direct output using std::wcout or similar; writes the constexpr `wchar_t` sequences,
+    ///        so nothing is converted at run time.
+    inline std::wostream&operator<<(std::wostream& os, const Color& color) {
+        os<< (color.isBackgroundColor() ? Wide_Escape_Codes::Reset::BgColor : Wide_Escape_Codes::Reset::FgColor)
+          << Wide_Escape_Codes::color_code(remap_color(color, color_vision(os)));
+        return os;
+    }
+}
+
+/// @brief  Helper namespace for the color definitions in the ansi_colors namespace.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_color_categories_defined_ {
+    /// @brief Overloads `operator<<` to insert the escape sequence of a palette's `defaultColor()` into an output stream
+    ///        (e.g. Pure_Red for `fg::PrimaryColors.Red`).
+    /// @param os The output stream to write to.
+    /// @param palette The color palette (Red, Green, ..., White).
+    /// @return A reference to the modified `std::ostream`.
+    template<typename Data, bool BgColor>
+    inline std::ostream&operator<<(std::ostream& os, const Color_Palette<Data, BgColor>& palette){
+        os<< palette.defaultColor();
+        return os;
+    }
+
+    /// @brief Overloads `operator<<` to insert the (`wchar_t`) escape sequence of a palette's `defaultColor()` into a wide output stream.
+    /// @param os The wide output stream to write to.
+    /// @param palette The color palette (Red, Green, ..., White).
+    /// @return A reference to the modified `std::wostream`.
+    template<typename Data, bool BgColor>
+    inline std::wostream&operator<<(std::wostream& os, const Color_Palette<Data, BgColor>& palette){
+        os<< palette.defaultColor();
+        return os;
+    }
+}
+
+#endif
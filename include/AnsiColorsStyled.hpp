@@ -0,0 +1,214 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_STYLED_HPP
+#define LEMONCODE_ANSICOLORS_STYLED_HPP
+
+#include "AnsiColorsCell.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief A string with styles kept out of band: the plain (UTF-8) text, and a compact list of style runs
+    ///        (`offset`, packed `Cell_Style`), each of which applies until the next run.
+    ///
+    /// Width, truncation, search and concatenation work on the plain text, without parsing escape sequences.
+    /// The escape sequences are only generated by `render()`, at the color depth of the sink.
+    /// Like `Screen`, every code point is assumed to be one column wide.
+    /// @code
+    /// Styled_String status;
+    /// status.append("build ").append("FAILED", fg::PrimaryColors.Red.Pure_Red).append(" in 3.2s");
+    /// std::string out;
+    /// status.truncated(12, "…").render(out, Color_Depth::Ansi16);
+    /// @endcode
+    class Styled_String {
+    public:
+        /// @brief A style run: `style` applies from byte `offset` until the next run.
+        struct Run {
+            uint32_t offset;
+            uint32_t style;
+        };
+    private:
+        std::string plain;
+        std::vector<Run> runs;      // Sorted by offset; adjacent runs have different styles; no leading `Cell_Style::Default` run.
+
+        static constexpr bool isContinuation(char c) noexcept { return (static_cast<unsigned char>(c) & 0xC0) == 0x80; }
+
+        void pushRun(std::size_t offset, uint32_t style){
+            if(!runs.empty() && runs.back().offset == offset) runs.pop_back();
+            const uint32_t previous = runs.empty() ? Cell_Style::Default : runs.back().style;
+            if(previous != style) runs.push_back(Run{static_cast<uint32_t>(offset), style});
+        }
+
+        /// @brief Returns the number of code points in `text`.
+        static std::size_t columnsOf(std::string_view text) noexcept {
+            std::size_t columns = 0;
+            for(char c : text) columns += !isContinuation(c);
+            return columns;
+        }
+
+        /// @brief Returns the byte offset after the first `columns` code points of `text` (or its size, if it's shorter).
+        static std::size_t columnOffset(std::string_view text, std::size_t columns) noexcept {
+            std::size_t offset = 0;
+            for(; offset < text.size(); ++offset){
+                if(!isContinuation(text[offset]) && columns-- == 0) break;
+            }
+            return offset;
+        }
+    public:
+        inline static constexpr std::size_t npos = std::string::npos;
+
+        Styled_String() = default;
+
+        /// @brief Creates a string with a single style.
+        explicit Styled_String(std::string text, uint32_t style = Cell_Style::Default) : plain(std::move(text)){
+            if(!plain.empty()) pushRun(0, style);
+        }
+
+        /// @brief Appends text with a packed `Cell_Style` (e.g. `Cell_Style::fg(196) | Cell_Style::Bold`).
+        Styled_String& append(std::string_view text, uint32_t style = Cell_Style::Default){
+            if(text.empty()) return *this;
+            pushRun(plain.size(), style);
+            plain += text;
+            return *this;
+        }
+
+        /// @brief Appends text in a color (e.g. `fg::PrimaryColors.Red.Pure_Red`).
+        Styled_String& append(std::string_view text, const Color& color){ return append(text, Cell_Style::from(color)); }
+
+        /// @brief Appends another styled string; its runs are shifted, not re-parsed.
+        Styled_String& append(const Styled_String& other){
+            if(other.plain.empty()) return *this;
+            const std::size_t base = plain.size();
+            pushRun(base, other.style_at(0));
+            for(const Run& run : other.runs){
+                if(run.offset != 0) pushRun(base + run.offset, run.style);
+            }
+            plain += other.plain;
+            return *this;
+        }
+
+        Styled_String&operator+=(const Styled_String& other){ return append(other); }
+        Styled_String&operator+=(std::string_view text){ return append(text); }
+
+        friend Styled_String operator+(Styled_String left, const Styled_String& right){ return left.append(right); }
+
+        /// @brief Sets the style of the bytes `offset` – `offset + count` (e.g. to highlight a search result).
+        Styled_String& set_style(std::size_t offset, std::size_t count, uint32_t style){
+            if(offset >= plain.size() || count == 0) return *this;
+            const std::size_t end = count > plain.size() - offset ? plain.size() : offset + count;
+            const uint32_t after = style_at(end);
+            std::vector<Run> old;
+            old.swap(runs);
+            std::size_t index = 0;
+            for(; index < old.size() && old[index].offset < offset; ++index) pushRun(old[index].offset, old[index].style);
+            pushRun(offset, style);
+            if(end < plain.size()) pushRun(end, after);
+            for(; index < old.size(); ++index){
+                if(old[index].offset > end) pushRun(old[index].offset, old[index].style);
+            }
+            return *this;
+        }
+
+        /// @brief Returns the plain text, without any escape sequences.
+        const std::string& text() const noexcept { return plain; }
+
+        /// @brief Returns the style runs.
+        const std::vector<Run>& style_runs() const noexcept { return runs; }
+
+        /// @brief Returns the size of the plain text, in bytes.
+        std::size_t size() const noexcept { return plain.size(); }
+
+        bool empty() const noexcept { return plain.empty(); }
+
+        /// @brief Returns the width of the text in columns (the number of code points).
+        std::size_t width() const noexcept { return columnsOf(plain); }
+
+        /// @brief Returns the style of the byte at `offset` (the last style for offsets past the end).
+        uint32_t style_at(std::size_t offset) const noexcept {
+            std::size_t low = 0, high = runs.size();
+            while(low < high){
+                const std::size_t middle = (low + high) / 2;
+                if(runs[middle].offset <= offset) low = middle + 1;
+                else high = middle;
+            }
+            return low == 0 ? Cell_Style::Default : runs[low - 1].style;
+        }
+
+        /// @brief Finds text in the plain text.
+        /// @return The byte offset of the first match at or after `offset`, or `npos`.
+        std::size_t find(std::string_view text, std::size_t offset = 0) const noexcept { return plain.find(text, offset); }
+
+        /// @brief Returns the bytes `offset` – `offset + count` with their styles.
+        Styled_String substr(std::size_t offset, std::size_t count = npos) const {
+            Styled_String result;
+            if(offset >= plain.size()) return result;
+            result.plain = plain.substr(offset, count);
+            if(result.plain.empty()) return result;
+            result.pushRun(0, style_at(offset));
+            for(const Run& run : runs){
+                if(run.offset > offset && run.offset - offset < result.plain.size()) result.pushRun(run.offset - offset, run.style);
+            }
+            return result;
+        }
+
+        /// @brief Returns the string cut off at `columns` columns. If it's cut off, the last columns are replaced by `ellipsis`
+        ///        (e.g. "…"), in the style of the last kept code point.
+        Styled_String truncated(std::size_t columns, std::string_view ellipsis = {}) const {
+            if(width() <= columns) return *this;
+            std::size_t ellipsis_width = columnsOf(ellipsis);
+            if(ellipsis_width > columns) ellipsis_width = columns;
+            const std::size_t cut = columnOffset(plain, columns - ellipsis_width);
+            Styled_String result = substr(0, cut);
+            if(ellipsis_width != 0){
+                result.append(ellipsis.substr(0, columnOffset(ellipsis, ellipsis_width)), style_at(cut == 0 ? 0 : cut - 1));
+            }
+            return result;
+        }
+
+        /// @brief Appends the text with the escape sequences for the given color depth, ending with the default style.
+        /// @param out The buffer to append to.
+        /// @param depth The color capability of the sink. Default = `Color_Depth::Ansi256`.
+        /// @param vision The color vision of the viewer (see `color_vision_map()`). Default = `Color_Vision::Normal`.
+        void render(std::string& out, Color_Depth depth = Color_Depth::Ansi256, Color_Vision vision = Color_Vision::Normal) const {
+            uint32_t current = Cell_Style::Default;
+            std::size_t copied = 0;
+            for(const Run& run : runs){
+                out.append(plain, copied, run.offset - copied);
+                Cell_Style::append_transition(out, current, run.style, depth, vision);
+                current = run.style;
+                copied = run.offset;
+            }
+            out.append(plain, copied, npos);
+            Cell_Style::append_transition(out, current, Cell_Style::Default, depth, vision);
+        }
+
+        /// @brief Returns the rendered text (see `render()`).
+        std::string str(Color_Depth depth = Color_Depth::Ansi256, Color_Vision vision = Color_Vision::Normal) const {
+            std::string out;
+            out.reserve(plain.size() + runs.size() * 16 + 8);
+            render(out, depth, vision);
+            return out;
+        }
+
+        bool operator==(const Styled_String& other) const noexcept {
+            if(plain != other.plain || runs.size() != other.runs.size()) return false;
+            for(std::size_t index = 0; index < runs.size(); ++index){
+                if(runs[index].offset != other.runs[index].offset || runs[index].style != other.runs[index].style) return false;
+            }
+            return true;
+        }
+        bool operator!=(const Styled_String& other) const noexcept { return !(*this == other); }
+    };
+}
+
+#endif
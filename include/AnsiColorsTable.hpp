@@ -0,0 +1,178 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_TABLE_HPP
+#define LEMONCODE_ANSICOLORS_TABLE_HPP
+
+#include "AnsiColorsCell.hpp"
+#include "AnsiColorsStream.hpp"
+#include <initializer_list>
+#include <ostream>
+#include <vector>
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The specification of a `Table_Writer` column: its header, style, alignment and width limits.
+    struct Column_Spec {
+        enum class Align : uint8_t { Left, Right };
+
+        std::string header;
+        /// @brief The packed `Cell_Style` of the values in this column.
+        uint32_t style = Cell_Style::Default;
+        Align align = Align::Left;
+        /// @brief The column is at least this wide, even if the header and all values are narrower.
+        unsigned min_width = 0;
+        /// @brief Longer values are truncated (with a trailing '…'). 0 = no limit.
+        unsigned max_width = 0;
+
+        Column_Spec(std::string header, uint32_t style = Cell_Style::Default, Align align = Align::Left, unsigned max_width = 0,
+                    unsigned min_width = 0)
+            : header(std::move(header)), style(style), align(align), min_width(min_width), max_width(max_width){}
+
+        Column_Spec(std::string header, const Color& color, Align align = Align::Left, unsigned max_width = 0, unsigned min_width = 0)
+            : header(std::move(header)), style(Cell_Style::from(color)), align(align), min_width(min_width), max_width(max_width){}
+    };
+
+    /// @brief Streams rows as a colored, aligned table without holding the whole data set in memory.
+    ///
+    /// Rows are collected in a bounded look-ahead window. When the window is full, the column widths are computed over the window
+    /// (widths only grow, so earlier rows stay aligned with later ones as far as possible), and the rows are written,
+    /// each row as a single `write()` to the stream. The escape sequences of every column are computed once.
+    class Table_Writer {
+        std::ostream& os;
+        std::vector<Column_Spec> columns;
+        std::vector<std::string> style_on;      // Precomputed escape sequence per column.
+        std::vector<unsigned> widths;
+        std::vector<std::string> window;        // Buffered cell values, row-major.
+        std::size_t window_rows = 0;
+        std::size_t lookahead;
+        std::string separator;
+        std::string line;
+        bool header_written = false;
+
+        /// @brief The number of terminal columns of a UTF-8 value (every code point counts as one column).
+        static unsigned displayWidth(std::string_view value) noexcept {
+            unsigned width = 0;
+            for(char c : value) width += (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+            return width;
+        }
+
+        void appendCell(std::size_t column, std::string_view value, const std::string& on, bool last){
+            const Column_Spec& spec = columns[column];
+            const unsigned width = widths[column];
+            unsigned value_width = displayWidth(value);
+            bool truncated = false;
+            if(value_width > width){
+                // Cut at a code point boundary, leaving room for the ellipsis.
+                std::size_t bytes = 0;
+                for(unsigned kept = 0; width != 0 && bytes < value.size(); ++bytes){
+                    if((static_cast<unsigned char>(value[bytes]) & 0xC0) != 0x80 && kept++ == width - 1) break;
+                }
+                value = value.substr(0, bytes);
+                value_width = width;
+                truncated = width != 0;
+            }
+            const unsigned padding = width - value_width;
+            if(spec.align == Column_Spec::Align::Right) line.append(padding, ' ');
+            // A truncated value can be cut down to nothing (a column of width 1); the ellipsis is still written.
+            if(!value.empty() || truncated){
+                line += on;
+                line += value;
+                if(truncated) line += "…";
+                if(!on.empty()) line += Reset::All;
+            }
+            if(spec.align == Column_Spec::Align::Left && !last) line.append(padding, ' ');
+            if(!last) line += separator;
+        }
+
+        void writeLine(){
+            line += '\n';
+            os.write(line.data(), static_cast<std::streamsize>(line.size()));
+            line.clear();
+        }
+
+        void flushWindow(){
+            const std::size_t column_count = columns.size();
+            for(std::size_t row = 0; row < window_rows; ++row){
+                for(std::size_t column = 0; column < column_count; ++column){
+                    unsigned width = displayWidth(window[row * column_count + column]);
+                    if(columns[column].max_width != 0 && width > columns[column].max_width) width = columns[column].max_width;
+                    if(width > widths[column]) widths[column] = width;
+                }
+            }
+            if(!header_written){
+                static const std::string bold = TextStyle::Bold;
+                for(std::size_t column = 0; column < column_count; ++column){
+                    appendCell(column, columns[column].header, bold, column + 1 == column_count);
+                }
+                writeLine();
+                header_written = true;
+            }
+            for(std::size_t row = 0; row < window_rows; ++row){
+                for(std::size_t column = 0; column < column_count; ++column){
+                    appendCell(column, window[row * column_count + column], style_on[column], column + 1 == column_count);
+                }
+                writeLine();
+            }
+            window_rows = 0;
+        }
+    public:
+        Table_Writer() = delete;
+        Table_Writer(const Table_Writer&) = delete;
+        Table_Writer&operator=(const Table_Writer&) = delete;
+
+        /// @brief Creates a table writer.
+        /// @param os The stream to write to; the colors are remapped for its color vision (see `set_color_vision()`).
+        /// @param columns The column specifications.
+        /// @param lookahead The number of rows over which the column widths are computed before they are written. Default = 256.
+        /// @param separator The text between two columns. Default = two spaces.
+        Table_Writer(std::ostream& os, std::vector<Column_Spec> columns, std::size_t lookahead = 256, std::string separator = "  ")
+            : os(os), columns(std::move(columns)), lookahead(lookahead ? lookahead : 1), separator(std::move(separator)){
+            const std::size_t column_count = this->columns.size();
+            style_on.resize(column_count);
+            widths.resize(column_count);
+            for(std::size_t column = 0; column < column_count; ++column){
+                const Column_Spec& spec = this->columns[column];
+                Cell_Style::append_transition(style_on[column], Cell_Style::Default, spec.style, Color_Depth::Ansi256, color_vision(os));
+                unsigned width = displayWidth(spec.header);
+                widths[column] = width > spec.min_width ? width : spec.min_width;
+                if(spec.max_width != 0 && widths[column] > spec.max_width) widths[column] = spec.max_width;
+            }
+            window.resize(this->lookahead * column_count);
+        }
+
+        /// @brief Adds a row; missing values are left empty and surplus values are ignored.
+        ///        The row is written once the look-ahead window is full.
+        void add_row(std::initializer_list<std::string_view> values){ add_row(values.begin(), values.size()); }
+
+        /// @brief Adds a row of `count` values; see `add_row(std::initializer_list)`.
+        void add_row(const std::string_view* values, std::size_t count){
+            const std::size_t column_count = columns.size();
+            std::string* row = window.data() + window_rows * column_count;
+            for(std::size_t column = 0; column < column_count; ++column){
+                if(column < count) row[column].assign(values[column].data(), values[column].size());
+                else row[column].clear();
+            }
+            if(++window_rows == lookahead) flushWindow();
+        }
+
+        /// @brief Writes the buffered rows (and the header, if nothing was written yet).
+        void flush(){
+            if(window_rows != 0 || !header_written) flushWindow();
+            os.flush();
+        }
+
+        ~Table_Writer() noexcept {
+            try { flush(); } catch(...) {}
+        }
+    };
+}
+
+#endif
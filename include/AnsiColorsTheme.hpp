@@ -0,0 +1,232 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_THEME_HPP
+#define LEMONCODE_ANSICOLORS_THEME_HPP
+
+#include "AnsiColorsNames.hpp"
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <vector>
+#include <cstring>
+
+/// @brief Helper namespace for parsing theme sources.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_theme_parser_helper_ {
+    inline constexpr bool isSpace(char c) noexcept { return c == ' ' || c == '\t' || c == '\r'; }
+
+    inline constexpr std::string_view trim(std::string_view str) noexcept {
+        while(!str.empty() && isSpace(str.front())) str.remove_prefix(1);
+        while(!str.empty() && isSpace(str.back())) str.remove_suffix(1);
+        return str;
+    }
+
+    inline constexpr int hexValue(char c) noexcept {
+        return (c >= '0' && c <= '9') ? c - '0'
+             : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+             : (c >= 'A' && c <= 'F') ? c - 'A' + 10
+             : -1;
+    }
+
+    /// @brief Resolves a color value: a color name (`Pure_Red`), a color code (`214`) or a hex color (`#ff8800`).
+    /// @return The ANSI 256 color code, or -1 if the value is not valid.
+    inline constexpr int resolveColor(std::string_view value) noexcept {
+        if(value.empty()) return -1;
+        if(value[0] == '#'){
+            if(value.size() != 7) return -1;
+            int rgb[3] = {0, 0, 0};
+            for(int i = 0; i < 3; ++i){
+                int hi = hexValue(value[1 + 2*i]), lo = hexValue(value[2 + 2*i]);
+                if(hi < 0 || lo < 0) return -1;
+                rgb[i] = hi*16 + lo;
+            }
+            return ansi_colors::rgb_to_ansi256(static_cast<uint8_t>(rgb[0]), static_cast<uint8_t>(rgb[1]), static_cast<uint8_t>(rgb[2]));
+        }
+        if(value[0] >= '0' && value[0] <= '9'){
+            if(value.size() > 3) return -1;
+            int code = 0;
+            for(char c : value){
+                if(c < '0' || c > '9') return -1;
+                code = code*10 + (c - '0');
+            }
+            return code <= 255 ? code : -1;
+        }
+        const ansi_colors::Named_Color* named = ansi_colors::find_color(value);
+        return named ? named->code : -1;
+    }
+
+    /// @brief Returns the SGR parameter of a `TextStyle` attribute name, or nullptr if the name is not an attribute.
+    inline constexpr const char* attributeParameter(std::string_view attribute) noexcept {
+        return attribute == "bold"          ? "1"
+             : attribute == "faint"         ? "2"
+             : attribute == "italic"        ? "3"
+             : attribute == "underline"     ? "4"
+             : attribute == "blink"         ? "5"
+             : attribute == "inverse"       ? "7"
+             : attribute == "hidden"        ? "8"
+             : attribute == "strikethrough" ? "9"
+             : nullptr;
+    }
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief A parsed theme: maps semantic roles (e.g. `error`, `warn`) to a precomputed, coalesced escape sequence.
+    ///
+    /// A theme source contains one role per line, `#` starts a comment:
+    /// @code
+    /// error = fg:Pure_Red bold
+    /// warn  = fg:214
+    /// note  = fg:#5fafff bg:Shade3 italic underline
+    /// @endcode
+    /// Colors can be given by palette/range name, by color code or as `#rrggbb`. Attributes are the lowercase `TextStyle` names.
+    /// Every role is compiled in to a single SGR sequence (starting with a reset, so the style never depends on the previous one),
+    /// and all sequences are stored back to back in one arena. Looking up a role is a single array index.
+    ///
+    /// A theme is immutable once parsed; to reload (e.g. on SIGHUP) parse a new theme with the same role list and swap it in,
+    /// role ids stay the same across reloads.
+    class Theme {
+        std::unique_ptr<char[]> arena;
+        std::vector<std::string_view> styles;
+        std::vector<std::string> role_names;
+
+        Theme() = default;
+
+        [[noreturn]] static void throwParseError(std::size_t line, const std::string& message){
+            throw std::invalid_argument("\nERROR: Invalid theme definition at line "+std::to_string(line)+":\n\n\t-"+message+"\n");
+        }
+
+        std::size_t findRole(std::string_view role) const noexcept {
+            for(std::size_t id = 0; id < role_names.size(); ++id){
+                if(role_names[id] == role) return id;
+            }
+            return role_names.size();
+        }
+    public:
+        Theme(const Theme&) = delete;
+        Theme&operator=(const Theme&) = delete;
+        Theme(Theme&&) noexcept = default;
+        Theme&operator=(Theme&&) noexcept = default;
+
+        /// @brief Parses a theme source.
+        /// @param source The theme definition text.
+        /// @param roles The roles known by the application; their index is the role id.
+        ///        If empty, the roles are numbered in order of appearance in the source. Default = {}.
+        /// @return The compiled theme. Declared roles that are not defined in the source map to an empty sequence.
+        /// @throws std::invalid_argument if the source contains a syntax error, an unknown color or attribute, or an undeclared role.
+        static Theme parse(std::string_view source, const std::vector<std::string>& roles = {}){
+            using namespace __LMN_theme_parser_helper_;
+            Theme theme;
+            theme.role_names = roles;
+            const bool fixed_roles = !roles.empty();
+            std::vector<std::string> sequences(roles.size());
+
+            std::size_t line_number = 0;
+            while(!source.empty()){
+                ++line_number;
+                std::size_t eol = source.find('\n');
+                std::string_view line = source.substr(0, eol);
+                source.remove_prefix(eol == std::string_view::npos ? source.size() : eol + 1);
+
+                std::size_t comment = line.find('#');
+                // A '#' directly after "fg:" or "bg:" is a hex color, not a comment.
+                while(comment != std::string_view::npos && comment > 0 && line[comment - 1] == ':'){
+                    comment = line.find('#', comment + 1);
+                }
+                line = trim(line.substr(0, comment));
+                if(line.empty()) continue;
+
+                std::size_t equals = line.find('=');
+                if(equals == std::string_view::npos) throwParseError(line_number, "Expected 'role = style'.");
+                std::string_view role = trim(line.substr(0, equals));
+                if(role.empty()) throwParseError(line_number, "Missing role name.");
+
+                std::size_t id = theme.findRole(role);
+                if(id == theme.role_names.size()){
+                    if(fixed_roles) throwParseError(line_number, "Undeclared role '"+std::string(role)+"'.");
+                    theme.role_names.emplace_back(role);
+                    sequences.emplace_back();
+                }
+
+                std::string params = "0";
+                std::string_view spec = line.substr(equals + 1);
+                while(!(spec = trim(spec)).empty()){
+                    std::size_t end = 0;
+                    while(end < spec.size() && !isSpace(spec[end])) ++end;
+                    std::string_view token = spec.substr(0, end);
+                    spec.remove_prefix(end);
+
+                    if(token.size() > 3 && (token.substr(0, 3) == "fg:" || token.substr(0, 3) == "bg:")){
+                        int code = resolveColor(token.substr(3));
+                        if(code < 0) throwParseError(line_number, "Unknown color '"+std::string(token.substr(3))+"'.");
+                        params += (token[0] == 'f' ? ";38;5;" : ";48;5;") + std::to_string(code);
+                    } else if(const char* attribute = attributeParameter(token)){
+                        params += ';';
+                        params += attribute;
+                    } else {
+                        throwParseError(line_number, "Unknown attribute '"+std::string(token)+"'.");
+                    }
+                }
+                sequences[id] = "\033[" + params + "m";
+            }
+
+            std::size_t arena_size = 0;
+            for(const std::string& sequence : sequences) arena_size += sequence.size();
+            theme.arena = std::make_unique<char[]>(arena_size + 1);
+            theme.styles.reserve(sequences.size());
+            char* position = theme.arena.get();
+            for(const std::string& sequence : sequences){
+                std::memcpy(position, sequence.data(), sequence.size());
+                theme.styles.emplace_back(position, sequence.size());
+                position += sequence.size();
+            }
+            return theme;
+        }
+
+        /// @brief Reads and parses a theme file.
+        /// @param path The path of the theme file.
+        /// @param roles The roles known by the application, see `parse()`. Default = {}.
+        /// @return The compiled theme.
+        /// @throws std::runtime_error if the file cannot be read; std::invalid_argument if the file is not a valid theme.
+        static Theme load(const std::string& path, const std::vector<std::string>& roles = {}){
+            std::ifstream file(path, std::ios::binary);
+            if(!file) throw std::runtime_error("\nERROR: Cannot open theme file '"+path+"'\n");
+            std::ostringstream content;
+            content<< file.rdbuf();
+            return parse(content.str(), roles);
+        }
+
+        /// @brief Returns the precomputed escape sequence of a role.
+        /// @param role_id The id of the role (valid range: 0 – size() - 1).
+        /// @return A view in to the theme's arena, valid for the lifetime of the theme.
+        std::string_view operator[](std::size_t role_id) const noexcept { return styles[role_id]; }
+
+        /// @brief Resolves a role name to its id; intended to be called once at startup, not on the hot path.
+        /// @param role The role name.
+        /// @return The role id.
+        /// @throws std::out_of_range if the theme has no role with this name.
+        std::size_t role_id(std::string_view role) const {
+            std::size_t id = findRole(role);
+            if(id == role_names.size()) throw std::out_of_range("\nERROR: Unknown theme role '"+std::string(role)+"'\n");
+            return id;
+        }
+
+        /// @brief Returns the name of a role.
+        const std::string& role_name(std::size_t role_id) const noexcept { return role_names[role_id]; }
+
+        /// @brief Returns the number of roles.
+        std::size_t size() const noexcept { return styles.size(); }
+
+        ~Theme() noexcept = default;
+    };
+}
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_VISION_HPP
+#define LEMONCODE_ANSICOLORS_VISION_HPP
+
+// Remap tables for color vision deficiencies: for protanopia, deuteranopia and tritanopia, every color code is mapped to the
+// code that keeps it distinguishable for such a viewer. The tables are generated (offline, see `remapCode()`) by daltonization:
+// simulate how the color is seen, and shift the information that is lost in to the channels that are still seen.
+// The result is mapped to the nearest of the codes 16 – 255 (by RGB distance), whose RGB values don't depend on the terminal theme.
+//
+// The sinks apply a table with a single index per color (see `Cell_Style::append_transition()`, `Screen::set_color_vision()`
+// and `set_color_vision()` in AnsiColorsStream.hpp); `Color_Vision::Normal` is the identity table.
+
+#include "AnsiColorsInfo.hpp"
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The color vision of the viewer of a sink.
+    enum class Color_Vision : uint8_t {
+        /// @brief No remapping.
+        Normal,
+        /// @brief No (working) L cones: red – green deficiency, reds look dark.
+        Protanopia,
+        /// @brief No (working) M cones: red – green deficiency, the most common one.
+        Deuteranopia,
+        /// @brief No (working) S cones: blue – yellow deficiency.
+        Tritanopia
+    };
+}
+
+/// @brief Helper namespace for the compile time color vision tables.
+/// @warning Users of this header should not modify the declarations or definitions in this namespace.
+namespace __LMN_vision_helper_ {
+    using ansi_colors::Color_Table;
+    using ansi_colors::Color_Vision;
+
+    /// @brief Returns the color (0 – 255 per channel) as seen with the given deficiency, with the (full severity) matrices of
+    ///        Machado, Oliveira and Fernandes (2009), applied to the sRGB values directly.
+    constexpr void simulate(Color_Vision vision, float& r, float& g, float& b) noexcept {
+        constexpr float matrices[4][9] = {
+            {1.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 1.0f},
+            {0.152286f, 1.052583f, -0.204868f,  0.114503f, 0.786281f, 0.099216f,  -0.003882f, -0.048116f, 1.051998f},
+            {0.367322f, 0.860646f, -0.227968f,  0.280085f, 0.672501f, 0.047413f,  -0.011820f, 0.042940f, 0.968881f},
+            {1.255528f, -0.076749f, -0.178779f,  -0.078411f, 0.930809f, 0.147602f,  0.004733f, 0.691367f, 0.303900f}
+        };
+        const float* m = matrices[static_cast<uint8_t>(vision) & 3];
+        const float sr = m[0] * r + m[1] * g + m[2] * b,
+                    sg = m[3] * r + m[4] * g + m[5] * b,
+                    sb = m[6] * r + m[7] * g + m[8] * b;
+        r = sr;
+        g = sg;
+        b = sb;
+    }
+
+    constexpr int clamp(float value) noexcept {
+        return value < 0.0f ? 0 : value > 255.0f ? 255 : static_cast<int>(value + 0.5f);
+    }
+
+    /// @brief Returns the code that replaces `code` for the given color vision (the generator of `maps`).
+    constexpr uint8_t remapCode(Color_Vision vision, int code) noexcept {
+        if(vision == Color_Vision::Normal) return static_cast<uint8_t>(code);
+        const float r = Color_Table::red[code], g = Color_Table::green[code], b = Color_Table::blue[code];
+        float sr = r, sg = g, sb = b;
+        simulate(vision, sr, sg, sb);
+        const float er = r - sr, eg = g - sg, eb = b - sb;
+        // Shift the error that is lost in to green and blue (the shift matrix of Fidaner, Lin and Ozguven).
+        const int tr = clamp(r), tg = clamp(g + 0.7f * er + eg), tb = clamp(b + 0.7f * er + eb);
+        int best = 16, best_distance = 3 * 256 * 256;
+        for(int candidate = 16; candidate < 256; ++candidate){
+            const int dr = Color_Table::red[candidate] - tr,
+                      dg = Color_Table::green[candidate] - tg,
+                      db = Color_Table::blue[candidate] - tb;
+            const int distance = dr*dr + dg*dg + db*db;
+            if(distance < best_distance){
+                best_distance = distance;
+                best = candidate;
+            }
+        }
+        return static_cast<uint8_t>(best);
+    }
+
+    /// @brief The remap tables, indexed by `Color_Vision` and color code: `remapCode()` of every code, generated offline.
+    ///        Evaluating them at compile time would cost every translation unit that includes a sink ~180k loop iterations.
+    inline constexpr uint8_t maps[4][256] = {
+        {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+            48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+            64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+            80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+            96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+            112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+            128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+            144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+            160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+            176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+            192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+            208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+            224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+            240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
+        },
+        {
+            16, 95, 22, 100, 18, 98, 235, 250, 244, 210, 28, 226, 21, 213, 29, 231,
+            16, 17, 18, 19, 20, 21, 233, 234, 23, 24, 25, 26, 22, 22, 23, 23,
+            24, 25, 22, 22, 22, 23, 23, 25, 22, 22, 22, 22, 23, 24, 28, 28,
+            28, 28, 29, 29, 238, 61, 62, 63, 63, 63, 58, 59, 60, 61, 62, 63,
+            58, 59, 242, 66, 68, 69, 64, 64, 65, 66, 67, 68, 64, 64, 65, 71,
+            72, 73, 70, 70, 70, 71, 72, 73, 95, 97, 98, 99, 99, 99, 94, 243,
+            103, 104, 105, 105, 100, 101, 102, 103, 104, 105, 100, 101, 101, 246, 109, 111,
+            106, 106, 107, 108, 109, 110, 106, 106, 107, 107, 114, 115, 131, 134, 135, 135,
+            135, 135, 136, 138, 139, 140, 141, 141, 136, 137, 247, 146, 147, 147, 142, 143,
+            144, 145, 146, 147, 142, 143, 143, 144, 250, 152, 148, 148, 149, 150, 151, 152,
+            168, 170, 171, 171, 171, 171, 173, 175, 176, 183, 183, 183, 178, 180, 181, 182,
+            183, 183, 178, 179, 180, 251, 189, 189, 184, 185, 186, 187, 188, 189, 184, 185,
+            185, 186, 187, 254, 210, 213, 213, 213, 213, 213, 215, 217, 218, 219, 219, 219,
+            215, 217, 218, 219, 225, 225, 220, 222, 223, 224, 225, 225, 220, 221, 222, 223,
+            255, 231, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+            240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
+        },
+        {
+            16, 89, 22, 94, 18, 92, 23, 250, 244, 198, 34, 220, 21, 207, 42, 231,
+            16, 17, 19, 20, 21, 21, 22, 23, 23, 24, 25, 27, 22, 22, 23, 30,
+            31, 32, 28, 28, 29, 29, 30, 31, 34, 34, 34, 35, 36, 37, 34, 40,
+            40, 40, 41, 42, 52, 55, 56, 57, 57, 57, 58, 59, 60, 61, 63, 63,
+            58, 65, 66, 67, 68, 69, 64, 64, 71, 72, 73, 74, 70, 70, 71, 71,
+            73, 80, 76, 76, 76, 77, 78, 79, 89, 91, 92, 93, 93, 99, 94, 95,
+            97, 98, 99, 105, 100, 101, 102, 103, 104, 105, 100, 107, 107, 109, 110, 111,
+            106, 106, 107, 114, 115, 116, 112, 112, 113, 113, 114, 116, 125, 127, 129, 135,
+            135, 135, 130, 132, 133, 140, 141, 141, 136, 137, 138, 140, 141, 141, 136, 143,
+            144, 145, 146, 147, 142, 143, 149, 150, 152, 153, 148, 148, 149, 150, 157, 158,
+            161, 164, 171, 171, 171, 171, 166, 168, 176, 177, 177, 177, 172, 174, 175, 176,
+            183, 183, 178, 179, 180, 181, 183, 183, 178, 185, 186, 187, 188, 189, 184, 184,
+            185, 192, 193, 195, 198, 206, 207, 207, 207, 207, 203, 211, 212, 213, 213, 213,
+            208, 210, 211, 219, 219, 219, 214, 216, 217, 218, 219, 225, 220, 221, 222, 223,
+            224, 225, 220, 227, 227, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+            240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
+        },
+        {
+            16, 88, 28, 100, 20, 92, 30, 250, 244, 196, 46, 226, 21, 201, 51, 231,
+            16, 19, 21, 21, 21, 21, 22, 23, 25, 27, 27, 27, 28, 29, 31, 32,
+            33, 33, 40, 35, 36, 38, 39, 39, 46, 46, 47, 49, 51, 51, 46, 46,
+            47, 49, 50, 51, 52, 55, 56, 57, 57, 57, 58, 59, 61, 63, 63, 63,
+            64, 65, 66, 68, 69, 69, 70, 70, 72, 73, 75, 75, 76, 76, 77, 79,
+            81, 81, 82, 82, 83, 84, 86, 87, 88, 90, 92, 93, 93, 93, 94, 95,
+            97, 98, 99, 99, 100, 101, 102, 104, 105, 105, 106, 106, 107, 109, 111, 111,
+            112, 112, 113, 115, 116, 117, 118, 118, 119, 120, 122, 123, 124, 126, 128, 129,
+            129, 129, 130, 131, 132, 134, 135, 135, 136, 137, 138, 140, 141, 141, 142, 142,
+            143, 145, 147, 147, 148, 148, 149, 150, 152, 153, 154, 154, 155, 156, 158, 159,
+            160, 162, 164, 165, 165, 165, 166, 167, 168, 170, 171, 171, 172, 172, 174, 175,
+            177, 177, 178, 178, 179, 181, 183, 183, 184, 184, 185, 186, 188, 189, 190, 190,
+            190, 192, 193, 195, 196, 198, 200, 201, 201, 201, 202, 203, 204, 206, 207, 207,
+            208, 208, 209, 211, 213, 213, 214, 214, 215, 217, 218, 219, 220, 220, 221, 222,
+            224, 225, 226, 226, 226, 227, 229, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+            240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
+        }
+    };
+
+    // Spot checks of the generated tables.
+    static_assert(maps[1][196] == remapCode(Color_Vision::Protanopia, 196) && maps[1][46] == remapCode(Color_Vision::Protanopia, 46) &&
+                  maps[1][9] == remapCode(Color_Vision::Protanopia, 9), "protanopia table is out of date");
+    static_assert(maps[2][196] == remapCode(Color_Vision::Deuteranopia, 196) && maps[2][46] == remapCode(Color_Vision::Deuteranopia, 46) &&
+                  maps[2][130] == remapCode(Color_Vision::Deuteranopia, 130), "deuteranopia table is out of date");
+    static_assert(maps[3][21] == remapCode(Color_Vision::Tritanopia, 21) && maps[3][226] == remapCode(Color_Vision::Tritanopia, 226) &&
+                  maps[3][14] == remapCode(Color_Vision::Tritanopia, 14), "tritanopia table is out of date");
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief Returns the remap table of a color vision: 256 color codes, indexed by color code.
+    inline constexpr const uint8_t* color_vision_map(Color_Vision vision) noexcept {
+        return __LMN_vision_helper_::maps[static_cast<uint8_t>(vision) & 3];
+    }
+
+    /// @brief Returns the color code that replaces `code` for a viewer with the given color vision.
+    inline constexpr uint8_t remap_color(uint8_t code, Color_Vision vision) noexcept {
+        return color_vision_map(vision)[code];
+    }
+
+    /// @brief Returns the color that replaces `color` (foreground or background) for a viewer with the given color vision.
+    inline constexpr Color remap_color(const Color& color, Color_Vision vision) noexcept {
+        return Color(color_vision_map(vision)[color.colorCode()], color.isBackgroundColor());
+    }
+}
+
+#endif
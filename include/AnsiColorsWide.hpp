@@ -0,0 +1,145 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This header is only for C++ v17 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+#ifndef LEMONCODE_ANSICOLORS_WIDE_HPP
+#define LEMONCODE_ANSICOLORS_WIDE_HPP
+
+// The escape sequences for character types other than `char`: `wchar_t`, `char8_t` (C++20), `char16_t` and `char32_t`.
+// The tables are converted from the `char` tables of the core at compile time, so writing a color to a wide (or UTF-8/16/32)
+// stream or string doesn't convert anything at run time. Like the core, it does not depend on <iostream>.
+
+#include "AnsiColorsCore.hpp"
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+// Intern constexpr helper namespace.
+namespace __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_ {
+    /// @brief A table of (ASCII) escape sequences, converted from `char` to `CharT` at compile time.
+    ///        Every entry is null terminated and at most 11 characters long (e.g. "\033[48;5;255m").
+    template<typename CharT, std::size_t N>
+    struct Widened_Table {
+        CharT codes[N][12] {};
+        uint8_t sizes[N] {};
+
+        constexpr explicit Widened_Table(const char* const (&source)[N]) noexcept {
+            for(std::size_t i = 0; i < N; ++i){
+                uint8_t size = 0;
+                for(; source[i][size] != '\0'; ++size) codes[i][size] = static_cast<CharT>(source[i][size]);
+                sizes[i] = size;
+            }
+        }
+    };
+
+    inline constexpr const char* text_styles[8] {
+        ansi_colors::TextStyle::Bold, ansi_colors::TextStyle::Faint, ansi_colors::TextStyle::Italic, ansi_colors::TextStyle::Underline,
+        ansi_colors::TextStyle::Blink, ansi_colors::TextStyle::Inverse, ansi_colors::TextStyle::Hidden, ansi_colors::TextStyle::Strikethrough
+    };
+
+    inline constexpr const char* resets[11] {
+        ansi_colors::Reset::All, ansi_colors::Reset::FgColor, ansi_colors::Reset::BgColor, ansi_colors::Reset::Bold,
+        ansi_colors::Reset::Faint, ansi_colors::Reset::Italic, ansi_colors::Reset::Underline, ansi_colors::Reset::Blink,
+        ansi_colors::Reset::Inverse, ansi_colors::Reset::Hidden, ansi_colors::Reset::Strikethrough
+    };
+
+    template<typename CharT>
+    inline constexpr Widened_Table<CharT, 256> wide_fg_color_code {fg_color_code};
+
+    template<typename CharT>
+    inline constexpr Widened_Table<CharT, 256> wide_bg_color_code {bg_color_code};
+
+    template<typename CharT>
+    inline constexpr Widened_Table<CharT, 8> wide_text_styles {text_styles};
+
+    template<typename CharT>
+    inline constexpr Widened_Table<CharT, 11> wide_resets {resets};
+}
+
+/// @brief Provides wrapper interfaces for ANSI 256‑color codes.
+namespace ansi_colors {
+    /// @brief The escape sequences of this API as `const CharT*`: the color codes, `TextStyle` and `Reset`.
+    ///        For `char` the color codes are the core tables themselves; everything else is a constexpr copy.
+    /// @tparam CharT The character type: `char`, `wchar_t`, `char8_t` (C++20), `char16_t` or `char32_t`.
+    template<typename CharT>
+    struct Basic_Escape_Codes {
+    private:
+        typedef __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::Widened_Table<CharT, 8> Style_Table;
+        typedef __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::Widened_Table<CharT, 11> Reset_Table;
+        static constexpr const Style_Table& styles = __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::wide_text_styles<CharT>;
+        static constexpr const Reset_Table& resets = __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::wide_resets<CharT>;
+    public:
+        Basic_Escape_Codes() noexcept = delete;
+
+        /// @brief Returns the `foreground` escape sequence of an ANSI 256 color code.
+        static constexpr const CharT* fg_color_code(uint8_t code) noexcept {
+            using namespace __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_;
+            if constexpr(std::is_same_v<CharT, char>) return __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::fg_color_code[code];
+            else return wide_fg_color_code<CharT>.codes[code];
+        }
+
+        /// @brief Returns the `background` escape sequence of an ANSI 256 color code.
+        static constexpr const CharT* bg_color_code(uint8_t code) noexcept {
+            using namespace __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_;
+            if constexpr(std::is_same_v<CharT, char>) return __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_::bg_color_code[code];
+            else return wide_bg_color_code<CharT>.codes[code];
+        }
+
+        /// @brief Returns the escape sequence of a color (the same sequence as `Color::c_str()`), including its length.
+        static constexpr std::basic_string_view<CharT> color_code(const Color& color) noexcept {
+            using namespace __LMN_color_categories_defined_::__CONSTEXPR_ANSI_code_conv_helper_funcs_;
+            const Widened_Table<CharT, 256>& table = color.isBackgroundColor() ? wide_bg_color_code<CharT> : wide_fg_color_code<CharT>;
+            return {table.codes[color.colorCode()], table.sizes[color.colorCode()]};
+        }
+
+        /// @brief The `TextStyle` escape sequences.
+        struct TextStyle {
+            TextStyle() noexcept = delete;
+
+            inline static constexpr const CharT* Bold =          styles.codes[0];
+            inline static constexpr const CharT* Faint =         styles.codes[1];
+            inline static constexpr const CharT* Italic =        styles.codes[2];
+            inline static constexpr const CharT* Underline =     styles.codes[3];
+            inline static constexpr const CharT* Blink =         styles.codes[4];
+            inline static constexpr const CharT* Inverse =       styles.codes[5];
+            inline static constexpr const CharT* Hidden =        styles.codes[6];
+            inline static constexpr const CharT* Strikethrough = styles.codes[7];
+        };
+
+        /// @brief The `Reset` escape sequences.
+        struct Reset {
+            Reset() noexcept = delete;
+
+            inline static constexpr const CharT* All =           resets.codes[0];
+            inline static constexpr const CharT* FgColor =       resets.codes[1];
+            inline static constexpr const CharT* BgColor =       resets.codes[2];
+            inline static constexpr const CharT* Bold =          resets.codes[3];
+            inline static constexpr const CharT* Faint =         resets.codes[4];
+            inline static constexpr const CharT* Italic =        resets.codes[5];
+            inline static constexpr const CharT* Underline =     resets.codes[6];
+            inline static constexpr const CharT* Blink =         resets.codes[7];
+            inline static constexpr const CharT* Inverse =       resets.codes[8];
+            inline static constexpr const CharT* Hidden =        resets.codes[9];
+            inline static constexpr const CharT* Strikethrough = resets.codes[10];
+        };
+    };
+
+    /// @brief The escape sequences as `const wchar_t*` (e.g. `Wide_Escape_Codes::Reset::All`).
+    typedef Basic_Escape_Codes<wchar_t> Wide_Escape_Codes;
+#ifdef __cpp_char8_t
+    /// @brief The escape sequences as `const char8_t*`.
+    typedef Basic_Escape_Codes<char8_t> UTF8_Escape_Codes;
+#endif
+    /// @brief The escape sequences as `const char16_t*`.
+    typedef Basic_Escape_Codes<char16_t> UTF16_Escape_Codes;
+    /// @brief The escape sequences as `const char32_t*`.
+    typedef Basic_Escape_Codes<char32_t> UTF32_Escape_Codes;
+}
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * This source header was made by Thomas Olijnsma. (2025)
+ * With the purpose of making working with the ANSI 256 color codes more easy and save.
+ * Read the documentation for more information.
+ * This module interface unit is only for C++ v20 and higher.
+ */
+
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// The `ansi_colors` module: `import ansi_colors;` instead of `#include "AnsiColors.hpp"`.
+// The headers are parsed once, when this interface unit is built; importers only load the compiled module interface.
+// Build it with the `ansi_colors::module` CMake target, enabled with -DANSICOLORS_BUILD_MODULE=ON (see CMakeLists.txt).
+
+module;
+
+#include "AnsiColors.hpp"
+
+export module ansi_colors;
+
+export namespace ansi_colors {
+    using ansi_colors::TextStyle;
+    using ansi_colors::Reset;
+    using ansi_colors::Color;
+    using ansi_colors::Defined_Color_Values;
+    using ansi_colors::Back_To_Default_Terminal_State;
+    using ansi_colors::rgb_to_ansi256;
+    using ansi_colors::Basic_Escape_Codes;
+    using ansi_colors::Wide_Escape_Codes;
+    using ansi_colors::UTF8_Escape_Codes;
+    using ansi_colors::UTF16_Escape_Codes;
+    using ansi_colors::UTF32_Escape_Codes;
+    using ansi_colors::Color_Vision;
+    using ansi_colors::Color_Vision_Setting;
+    using ansi_colors::color_vision_map;
+    using ansi_colors::remap_color;
+    using ansi_colors::set_color_vision;
+    using ansi_colors::color_vision;
+    using ansi_colors::operator<<;
+
+    namespace literals {
+        using ansi_colors::literals::operator""_fg;
+        using ansi_colors::literals::operator""_bg;
+    }
+
+    namespace fg {
+        using ansi_colors::fg::PrimaryColors;
+        using ansi_colors::fg::SecondaryColors;
+        using ansi_colors::fg::TertiaryColors;
+        using ansi_colors::fg::GrayScaleColors;
+    }
+
+    namespace bg {
+        using ansi_colors::bg::PrimaryColors;
+        using ansi_colors::bg::SecondaryColors;
+        using ansi_colors::bg::TertiaryColors;
+        using ansi_colors::bg::GrayScaleColors;
+    }
+}
+
+// The palette `operator<<` is found through argument dependent lookup, which only sees it in an importer when it's exported.
+export namespace __LMN_color_categories_defined_ {
+    using __LMN_color_categories_defined_::operator<<;
+}
+
+// The `std::formatter` specializations are not exported (they specialize a `std` template), but they have to be
+// reachable from the importers; naming them here keeps them from being discarded from the global module fragment.
+namespace __LMN_color_categories_defined_::__module_formatters_ {
+    using char_formatter = std::formatter<ansi_colors::Color, char>;
+    using wchar_formatter = std::formatter<ansi_colors::Color, wchar_t>;
+    using palette_formatter = std::formatter<Color_Palette<Red_Palette, false>, char>;
+}
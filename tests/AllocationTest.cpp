@@ -0,0 +1,103 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Checks that the hot paths of AnsiColors.hpp don't allocate: streaming colors and palettes, palette `operator[]` and `at()`,
+// `rgb_to_ansi256()` and (where <format> is available) formatting colors and palettes.
+// Global operator new is replaced by a counting version; every path is run once to warm up, then checked over many runs.
+//
+// Build: CMake targets `allocation_test` and (C++20, with the format checks) `allocation_test_cxx20` (run by ctest),
+// or g++ -std=c++17 -I include tests/AllocationTest.cpp -o allocation_test
+
+#include "AnsiColors.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#if LEMONCODE_ANSICOLORS_CPP20_OR_NEWER && defined(__cpp_lib_format)
+    #include <format>
+    #include <iterator>
+    #define ANSICOLORS_TEST_FORMAT 1
+#elif defined(ANSICOLORS_TEST_REQUIRE_FORMAT)
+    #error "allocation_test_cxx20 has to be built as C++20 with <format>"
+#else
+    #define ANSICOLORS_TEST_FORMAT 0
+#endif
+
+using namespace ansi_colors;
+
+namespace {
+    std::atomic<std::uint64_t> allocation_count {0};
+}
+
+void* operator new(std::size_t size){
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if(void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size){ return ::operator new(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace {
+    /// A stream buffer that discards everything.
+    class Null_Buffer final : public std::streambuf {
+    protected:
+        int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+
+    volatile unsigned sink = 0;
+    int failures = 0;
+
+    /// Runs `path` once to warm up, then 1000 times; fails if any of those runs allocates.
+    template<typename Path>
+    void check(const char* name, Path path){
+        path();
+        const std::uint64_t before = allocation_count.load();
+        for(int run = 0; run < 1000; ++run) path();
+        const std::uint64_t allocations = allocation_count.load() - before;
+        std::printf("%-28s %s", name, allocations == 0 ? "ok\n" : "FAILED: ");
+        if(allocations != 0){
+            std::printf("%llu allocations in 1000 runs\n", static_cast<unsigned long long>(allocations));
+            ++failures;
+        }
+    }
+}
+
+int main(){
+    Null_Buffer buffer;
+    std::ostream os(&buffer);
+
+    check("stream/color/fg", [&]{ os<< fg::PrimaryColors.Red.Pure_Red; });
+    check("stream/color/bg", [&]{ os<< bg::PrimaryColors.Blue.Navy_Blue; });
+    check("stream/palette", [&]{ os<< fg::SecondaryColors.Cyan; });
+    check("palette/operator[]", []{
+        for(uint8_t index = 1; index <= 48; ++index) sink += fg::PrimaryColors.Green[index].colorCode();
+    });
+    check("palette/at", []{
+        for(uint8_t index = 1; index <= 24; ++index) sink += fg::GrayScaleColors.Gray.at(index).colorCode();
+    });
+    check("rgb_to_ansi256", []{
+        for(unsigned value = 0; value < 256; ++value) sink += rgb_to_ansi256(static_cast<uint8_t>(value), static_cast<uint8_t>(value * 7), 40);
+    });
+#if ANSICOLORS_TEST_FORMAT
+    std::string out;
+    out.reserve(4096);
+    check("format/color", [&]{
+        out.clear();
+        std::format_to(std::back_inserter(out), "{}", fg::PrimaryColors.Red.Pure_Red);
+    });
+    check("format/palette", [&]{
+        out.clear();
+        std::format_to(std::back_inserter(out), "{}", fg::TertiaryColors.Orange);
+    });
+#endif
+
+    if(failures != 0) std::printf("%d path(s) allocate\n", failures);
+    return failures == 0 ? 0 : 1;
+}
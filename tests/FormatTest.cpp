@@ -0,0 +1,61 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Checks the std::format integration (AnsiColorsFormat.hpp, C++20): every palette, foreground and background, formats
+// (`char` and `wchar_t`) the same as its `defaultColor()` and the same as `operator<<` writes it, which is what the former
+// per-palette formatters produced through a `basic_ostringstream`.
+//
+// Build: CMake target `format_test` (run by ctest; only where the standard library has <format>),
+// or g++ -std=c++20 -I include tests/FormatTest.cpp -o format_test
+
+#include "AnsiColors.hpp"
+#include <cstdio>
+#include <format>
+#include <sstream>
+#include <string>
+
+using namespace ansi_colors;
+
+namespace {
+    int failures = 0;
+
+    template<typename Palette>
+    void check(const char* name, const Palette& palette){
+        std::ostringstream narrow;
+        std::wostringstream wide;
+        narrow<< palette;
+        wide<< palette;
+        const bool ok = std::format("{}", palette) == narrow.str() && std::format("{}", palette.defaultColor()) == narrow.str()
+                     && std::format(L"{}", palette) == wide.str() && std::format(L"{}", palette.defaultColor()) == wide.str()
+                     && std::format("[{:>24}]", palette) == std::format("[{:>24}]", narrow.str());
+        std::printf("%-28s %s\n", name, ok ? "ok" : "FAILED");
+        if(!ok) ++failures;
+    }
+
+    template<typename Primary, typename Secondary, typename Tertiary, typename GrayScale>
+    void checkAll(const char* side, const Primary& primary, const Secondary& secondary, const Tertiary& tertiary, const GrayScale& gray_scale){
+        const auto named = [side](const char* palette){ return std::string(side) + palette; };
+        check(named("Red").c_str(), primary.Red);
+        check(named("Green").c_str(), primary.Green);
+        check(named("Blue").c_str(), primary.Blue);
+        check(named("Cyan").c_str(), secondary.Cyan);
+        check(named("Yellow").c_str(), secondary.Yellow);
+        check(named("Purple").c_str(), secondary.Purple);
+        check(named("Orange").c_str(), tertiary.Orange);
+        check(named("Brown").c_str(), tertiary.Brown);
+        check(named("Violet").c_str(), tertiary.Violet);
+        check(named("Pink").c_str(), tertiary.Pink);
+        check(named("Black").c_str(), gray_scale.Black);
+        check(named("Gray").c_str(), gray_scale.Gray);
+        check(named("White").c_str(), gray_scale.White);
+        check(named("Red (shortcut)").c_str(), primary->R);
+    }
+}
+
+int main(){
+    checkAll("fg/", fg::PrimaryColors, fg::SecondaryColors, fg::TertiaryColors, fg::GrayScaleColors);
+    checkAll("bg/", bg::PrimaryColors, bg::SecondaryColors, bg::TertiaryColors, bg::GrayScaleColors);
+
+    if(failures != 0) std::printf("%d palette(s) failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
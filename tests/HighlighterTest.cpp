@@ -0,0 +1,77 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Checks the output of `Keyword_Highlighter` (AnsiColorsHighlight.hpp) on overlapping and prefix keywords,
+// against `Keyword_Rules` (AnsiColorsColorize.hpp) and against the expected output where `Keyword_Rules` has no equivalent (`whole_words = false`).
+//
+// Build: CMake target `highlighter_test` (run by ctest), or g++ -std=c++17 -pthread -I include tests/HighlighterTest.cpp -o highlighter_test
+
+#include "AnsiColorsColorize.hpp"
+#include "AnsiColorsHighlight.hpp"
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+using namespace ansi_colors;
+
+namespace {
+    typedef std::initializer_list<std::pair<const char*, const char*>> Keywords;
+
+    int failures = 0;
+
+    void expect(const char* name, const std::string& actual, const std::string& expected){
+        std::printf("%-36s %s\n", name, actual == expected ? "ok" : "FAILED");
+        if(actual == expected) return;
+        std::printf("    expected: %s\n    actual:   %s\n", expected.c_str(), actual.c_str());
+        ++failures;
+    }
+
+    /// Colorizes `text` with a (whole words) highlighter and with `Keyword_Rules`; the outputs have to be the same.
+    void compareWithRules(const char* name, Keywords keywords, const char* text){
+        Keyword_Highlighter highlighter;
+        Keyword_Rules rules;
+        for(const auto& keyword : keywords){
+            highlighter.add(keyword.first, keyword.second);
+            rules.add(keyword.first, keyword.second);
+        }
+        std::string highlighted, expected;
+        highlighter.colorize(text, highlighted);
+        rules.colorize(text, expected);
+        expect(name, highlighted, expected);
+    }
+
+    /// Colorizes `text` with a highlighter that also matches inside words.
+    void compareWithExpected(const char* name, Keywords keywords, const char* text, const std::string& expected){
+        Keyword_Highlighter highlighter(false);
+        for(const auto& keyword : keywords) highlighter.add(keyword.first, keyword.second);
+        std::string highlighted;
+        highlighter.colorize(text, highlighted);
+        expect(name, highlighted, expected);
+    }
+}
+
+int main(){
+    const std::string reset = Reset::All;
+
+    compareWithRules("whole_words/no_overlap", {{"ERROR", "<1>"}, {"WARN", "<2>"}}, "ERROR: disk WARN low, ERRORS none");
+    // "b cd" ends before "cd" but overlaps "ab"; the shorter "cd" on its output chain still matches.
+    compareWithRules("whole_words/overlap_on_chain", {{"ab", "<1>"}, {"b cd", "<2>"}, {"cd", "<3>"}}, "ab cd");
+    compareWithRules("whole_words/overlap_repeated", {{"ab", "<1>"}, {"b cd", "<2>"}, {"cd", "<3>"}}, "x ab cd ab cd y");
+    // A shorter keyword that ends first must not cut a longer one that starts at the same byte or earlier.
+    compareWithRules("whole_words/prefix", {{"api-gateway", "<1>"}, {"api", "<2>"}}, "call api-gateway now, then api");
+    compareWithRules("whole_words/prefix_chain", {{"auth-service-v2", "<1>"}, {"auth-service", "<2>"}, {"auth", "<3>"}},
+                     "auth auth-service auth-service-v2 auth-service-v3");
+    compareWithRules("whole_words/inner_keyword", {{"a b c", "<1>"}, {"b", "<2>"}}, "a b c, a b d");
+    compareWithRules("whole_words/overlap_longest_first", {{"foo bar", "<1>"}, {"bar", "<2>"}, {"bar baz", "<3>"}}, "foo bar baz");
+
+    compareWithExpected("substrings/overlap_on_chain", {{"ab", "<1>"}, {"bcd", "<2>"}, {"d", "<3>"}}, "abcd",
+                        "<1>ab" + reset + "c<3>d" + reset);
+    compareWithExpected("substrings/prefix", {{"api", "<1>"}, {"apis", "<2>"}, {"sync", "<3>"}}, "apisync",
+                        "<2>apis" + reset + "ync");
+    compareWithExpected("substrings/adjacent", {{"ab", "<1>"}, {"ba", "<2>"}}, "abab",
+                        "<1>ab" + reset + "<1>ab" + reset);
+
+    if(failures != 0) std::printf("%d case(s) failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
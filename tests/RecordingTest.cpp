@@ -0,0 +1,121 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Checks recordings (AnsiColorsRecording.hpp) end to end: raw ANSI output written in one call and split over many calls
+// (also inside escape sequences) gives the same recording; a saved recording renders back to output that records the same
+// again; `seek()` agrees with a linear scan at every offset; and corrupt files (text without runs, checkpoints out of order)
+// are rejected.
+//
+// Build: CMake target `recording_test` (run by ctest), or g++ -std=c++17 -I include tests/RecordingTest.cpp -o recording_test
+
+#include "AnsiColorsRecording.hpp"
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ansi_colors;
+
+namespace {
+    int failures = 0;
+
+    void expect(const char* name, bool ok){
+        std::printf("%-36s %s\n", name, ok ? "ok" : "FAILED");
+        if(!ok) ++failures;
+    }
+
+    /// About `lines` colored log lines, with SGR sequences of every kind the writer parses and a cursor movement it drops.
+    std::string makeCapture(std::size_t lines){
+        static const char* const levels[] = {"\033[32mINFO ", "\033[38;5;244mDEBUG", "\033[1;38;2;255;136;0mWARN ", "\033[91;4mERROR"};
+        std::mt19937 random(7);
+        std::string capture;
+        for(std::size_t line = 0; line < lines; ++line){
+            capture += "\033[90m12:00:" + std::to_string(line % 60) + "\033[0m ";
+            capture += levels[random() % 4];
+            capture += "\033[22;24;39m request \033[48;5;" + std::to_string(random() % 256) + "mid=" + std::to_string(random());
+            capture += "\033[49m\033[2K done\n";
+        }
+        return capture;
+    }
+
+    void save(const std::string& path, const std::string& data){
+        std::ofstream(path, std::ios::binary)<< data;
+    }
+
+    bool rejects(const std::string& path, const std::string& data){
+        save(path, data);
+        try {
+            Recording recording(path);
+        } catch(const std::runtime_error&){
+            return true;
+        }
+        return false;
+    }
+}
+
+int main(){
+    const std::string path = "recording_test.lmnrec";
+    const std::string capture = makeCapture(3000);
+
+    Recording_Writer whole;
+    whole.write_ansi(capture);
+    const std::string recorded = whole.serialize();
+
+    bool same = true;
+    for(std::size_t step : {1, 2, 3, 7, 64, 1000}){
+        Recording_Writer split;
+        for(std::size_t position = 0; position < capture.size(); position += step) split.write_ansi(std::string_view(capture).substr(position, step));
+        same = same && split.serialize() == recorded;
+    }
+    expect("write_ansi/split", same);
+
+    save(path, recorded);
+    {
+        const Recording recording(path);
+        expect("recording/text", recording.text() == std::string_view(recorded).substr(recorded.size() - whole.text_size())
+                                 && recording.text().find('\033') == std::string_view::npos);
+        expect("recording/checkpoints", recording.run_size() > 2 * __LMN_recording_helper_::checkpoint_interval);
+
+        std::string rendered;
+        recording.render(rendered);
+        Recording_Writer again;
+        again.write_ansi(rendered);
+        expect("render/round_trip", again.serialize() == recorded);
+
+        std::vector<std::size_t> run_end;
+        recording.for_each_run([&](const Recording::Run& run){
+            run_end.push_back((run_end.empty() ? 0 : run_end.back()) + run.text.size());
+        });
+        bool seek_ok = run_end.size() == recording.run_size() && recording.seek(recording.text().size()) == recording.run_size();
+        std::size_t run = 0;
+        for(std::size_t offset = 0; offset < recording.text().size() && seek_ok; ++offset){
+            while(run_end[run] <= offset) ++run;
+            seek_ok = recording.seek(offset) == run;
+        }
+        expect("seek/linear_scan", seek_ok);
+    }
+
+    // The header (see AnsiColorsRecording.hpp) of a recording without styles and runs, followed by 5 text bytes.
+    std::string text_without_runs(__LMN_recording_helper_::magic, 8);
+    __LMN_recording_helper_::put32(text_without_runs, __LMN_recording_helper_::version);
+    __LMN_recording_helper_::put32(text_without_runs, 0);
+    __LMN_recording_helper_::put64(text_without_runs, 0);
+    __LMN_recording_helper_::put64(text_without_runs, 0);
+    __LMN_recording_helper_::put64(text_without_runs, 5);
+    text_without_runs += "hello";
+    expect("reject/text_without_runs", rejects(path, text_without_runs));
+
+    // Swaps the first two checkpoints; both stay in range.
+    std::size_t checkpoints = __LMN_recording_helper_::header_size + 4 * __LMN_recording_helper_::get32(recorded.data() + 12);
+    checkpoints += checkpoints % 8;
+    std::string swapped = recorded;
+    swapped.replace(checkpoints, 32, recorded.substr(checkpoints + 16, 16) + recorded.substr(checkpoints, 16));
+    expect("reject/checkpoints_out_of_order", rejects(path, swapped));
+    expect("accept/original", !rejects(path, recorded));
+
+    std::remove(path.c_str());
+    if(failures != 0) std::printf("%d case(s) failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
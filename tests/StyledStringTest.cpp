@@ -0,0 +1,129 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Checks `Styled_String` (AnsiColorsStyled.hpp): random sequences of `append()`, `set_style()`, `substr()` and `operator+`
+// against a model with one style per byte, the invariants of the run list after every operation (sorted, inside the text,
+// adjacent runs differ, no leading default run, no runs on empty text), and `truncated()` on ASCII and multi byte text.
+//
+// Build: CMake target `styled_string_test` (run by ctest), or g++ -std=c++17 -I include tests/StyledStringTest.cpp -o styled_string_test
+
+#include "AnsiColorsStyled.hpp"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ansi_colors;
+
+namespace {
+    int failures = 0;
+
+    void expect(const char* name, bool ok){
+        std::printf("%-36s %s\n", name, ok ? "ok" : "FAILED");
+        if(!ok) ++failures;
+    }
+
+    /// The model: the text and the style of every byte.
+    struct Model {
+        std::string text;
+        std::vector<uint32_t> styles;
+    };
+
+    bool wellFormed(const Styled_String& styled){
+        const std::vector<Styled_String::Run>& runs = styled.style_runs();
+        if(styled.empty()) return runs.empty();
+        for(std::size_t index = 0; index < runs.size(); ++index){
+            const uint32_t previous = index == 0 ? Cell_Style::Default : runs[index - 1].style;
+            if(runs[index].offset >= styled.size() || runs[index].style == previous) return false;
+            if(index != 0 && runs[index].offset <= runs[index - 1].offset) return false;
+        }
+        return true;
+    }
+
+    bool matches(const Styled_String& styled, const Model& model){
+        if(styled.text() != model.text || !wellFormed(styled)) return false;
+        for(std::size_t offset = 0; offset < model.text.size(); ++offset){
+            if(styled.style_at(offset) != model.styles[offset]) return false;
+        }
+        return true;
+    }
+
+    void checkRandom(){
+        const uint32_t palette[4] = {Cell_Style::Default, Cell_Style::fg(196), Cell_Style::fg(196) | Cell_Style::Bold, Cell_Style::bg(21)};
+        std::mt19937 random(11);
+        bool ok = true;
+        for(int round = 0; round < 2000 && ok; ++round){
+            Styled_String styled;
+            Model model;
+            for(int step = 0; step < 12 && ok; ++step){
+                const uint32_t style = palette[random() % 4];
+                const std::size_t size = model.text.size();
+                switch(random() % 4){
+                    case 0: {
+                        const std::string text(random() % 4, static_cast<char>('a' + step));
+                        styled.append(text, style);
+                        model.text += text;
+                        model.styles.insert(model.styles.end(), text.size(), style);
+                        break;
+                    }
+                    case 1: {
+                        const std::size_t offset = random() % (size + 2), count = random() % 6;
+                        styled.set_style(offset, count, style);
+                        for(std::size_t byte = offset; byte < size && byte < offset + count; ++byte) model.styles[byte] = style;
+                        break;
+                    }
+                    case 2: {
+                        const std::size_t offset = random() % (size + 2), count = random() % 3 == 0 ? Styled_String::npos : random() % 6;
+                        styled = styled.substr(offset, count);
+                        if(offset >= size){
+                            model = Model{};
+                        } else {
+                            model.text = model.text.substr(offset, count);
+                            model.styles.erase(model.styles.begin(), model.styles.begin() + static_cast<std::ptrdiff_t>(offset));
+                            model.styles.resize(model.text.size());
+                        }
+                        break;
+                    }
+                    default: {
+                        Styled_String other = Styled_String("xy", style).set_style(1, 1, palette[random() % 4]);
+                        const uint32_t second = other.style_at(1);
+                        styled = styled + other;
+                        model.text += "xy";
+                        model.styles.push_back(style);
+                        model.styles.push_back(second);
+                        break;
+                    }
+                }
+                ok = matches(styled, model);
+            }
+        }
+        expect("random/append_set_style_substr_plus", ok);
+    }
+}
+
+int main(){
+    const uint32_t red = Cell_Style::fg(196), blue = Cell_Style::bg(21);
+
+    Styled_String status;
+    status.append("build ").append("FAILED", red).append(" in 3.2s");
+    expect("substr/empty", wellFormed(status.substr(6, 0)) && status.substr(6, 0).empty() && status.substr(20).empty());
+    expect("substr/styled", status.substr(6, 6) == Styled_String("FAILED", red)
+                            && status.substr(4, 4).style_runs().size() == 1 && status.substr(4, 4).style_at(2) == red);
+    expect("set_style/default_everywhere", Styled_String("abc", red).set_style(0, 3, Cell_Style::Default).style_runs().empty());
+    expect("set_style/past_end", Styled_String("abc", red).set_style(1, 100, blue) == Styled_String("a", red) + Styled_String("bc", blue));
+    expect("operator+/merges_runs", (Styled_String("ab", red) + Styled_String("cd", red)).style_runs().size() == 1
+                                    && (Styled_String() + Styled_String("cd", red)) == Styled_String("cd", red));
+
+    expect("truncated/fits", status.truncated(20) == status);
+    expect("truncated/ellipsis", status.truncated(10, "…") == Styled_String("build ") + Styled_String("FAI…", red));
+    expect("truncated/no_ellipsis", status.truncated(7) == Styled_String("build ") + Styled_String("F", red));
+    expect("truncated/zero", status.truncated(0).empty() && wellFormed(status.truncated(0)) && status.truncated(0, "…").empty());
+    const Styled_String wide = Styled_String("ä") + Styled_String("öü€x", blue);
+    expect("truncated/multi_byte", wide.truncated(3, "…") == Styled_String("ä") + Styled_String("ö…", blue)
+                                   && wide.truncated(3, "…").width() == 3);
+
+    checkRandom();
+
+    if(failures != 0) std::printf("%d case(s) failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
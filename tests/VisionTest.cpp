@@ -0,0 +1,32 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// Checks the generated color vision tables (AnsiColorsVision.hpp): every entry of `maps` has to be `remapCode()` of its
+// color vision and code (the header only spot checks a few entries at compile time), and `Color_Vision::Normal` has to be
+// the identity.
+//
+// Build: CMake target `vision_test` (run by ctest), or g++ -std=c++17 -I include tests/VisionTest.cpp -o vision_test
+
+#include "AnsiColorsVision.hpp"
+#include <cstdio>
+
+using namespace ansi_colors;
+
+int main(){
+    const char* names[4] = {"normal", "protanopia", "deuteranopia", "tritanopia"};
+    int failures = 0;
+    for(int vision = 0; vision < 4; ++vision){
+        int wrong = 0;
+        for(int code = 0; code < 256; ++code){
+            const uint8_t expected = __LMN_vision_helper_::remapCode(static_cast<Color_Vision>(vision), code);
+            const uint8_t actual = color_vision_map(static_cast<Color_Vision>(vision))[code];
+            if(actual == expected && (vision != 0 || actual == code)) continue;
+            if(wrong++ < 4) std::printf("    maps[%d][%d] = %d, remapCode() = %d\n", vision, code, actual, expected);
+        }
+        std::printf("%-28s %s\n", names[vision], wrong == 0 ? "ok" : "FAILED");
+        if(wrong != 0) ++failures;
+    }
+
+    if(failures != 0) std::printf("%d table(s) out of date\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+// Copyright: (c) 2025 Thomas Olijnsma
+// License: MIT: see LICENSE for more details
+
+// ansi-colorize: colors the log level keywords of a (large) log file, using all cores.
+//
+// Usage: ansi-colorize [-j threads] [-c chunk-MiB] <file>
+// Build: g++ -std=c++17 -O2 -pthread -I include tools/AnsiColorize.cpp -o ansi-colorize
+//        or with CMake: -DANSICOLORS_BUILD_TOOLS=ON, target `ansi-colorize`
+
+#include "AnsiColorsColorize.hpp"
+#include "AnsiColorsHighlight.hpp"
+#include "AnsiColorsPalette.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+using namespace ansi_colors;
+
+int main(int argc, char** argv){
+    std::size_t threads = 0, chunk_mib = 4;
+    const char* path = nullptr;
+    for(int i = 1; i < argc; ++i){
+        std::string_view argument = argv[i];
+        if((argument == "-j" || argument == "-c") && i + 1 < argc){
+            (argument == "-j" ? threads : chunk_mib) = std::strtoul(argv[++i], nullptr, 10);
+        } else if(!path && argument[0] != '-'){
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if(!path || chunk_mib == 0){
+        std::fprintf(stderr, "Usage: %s [-j threads] [-c chunk-MiB] <file>\n", argv[0]);
+        return 2;
+    }
+
+    Keyword_Highlighter rules;
+    rules.add("FATAL", fg::PrimaryColors.Red.Dark_Red);
+    rules.add("ERROR", fg::PrimaryColors.Red.Pure_Red);
+    rules.add("WARN", fg::TertiaryColors.Orange.Amber);
+    rules.add("WARNING", fg::TertiaryColors.Orange.Amber);
+    rules.add("INFO", fg::PrimaryColors.Green.Lime_Green);
+    rules.add("DEBUG", fg::GrayScaleColors.Gray[12]);
+    rules.add("TRACE", fg::GrayScaleColors.Gray[8]);
+    rules.prepare();
+
+    try {
+        colorize_file(path, STDOUT_FILENO, rules, threads, chunk_mib << 20);
+    } catch(const std::exception& e){
+        std::fprintf(stderr, "%s", e.what());
+        return 1;
+    }
+    return 0;
+}